@@ -990,26 +990,25 @@ namespace graphene { namespace app {
 
       auto plugin = _app.get_plugin<graphene::grouped_orders::grouped_orders_plugin>( "grouped_orders" );
       FC_ASSERT( plugin );
-      const auto& limit_groups = plugin->limit_order_groups();
       vector< limit_order_group > result;
 
       database_api_helper db_api_helper( _app );
       asset_id_type base_asset_id = db_api_helper.get_asset_from_string( base_asset )->get_id();
       asset_id_type quote_asset_id = db_api_helper.get_asset_from_string( quote_asset )->get_id();
 
-      price max_price = price::max( base_asset_id, quote_asset_id );
-      price min_price = price::min( base_asset_id, quote_asset_id );
+      const auto* book = plugin->get_limit_order_group_book( base_asset_id, quote_asset_id, group );
+      if( nullptr == book )
+         return result;
+
+      optional<price> max_price;
       if( start.valid() && !start->is_null() )
-         max_price = std::max( std::min( max_price, *start ), min_price );
+         max_price = std::max( std::min( price::max( base_asset_id, quote_asset_id ), *start ),
+                               price::min( base_asset_id, quote_asset_id ) );
 
-      auto itr = limit_groups.lower_bound( limit_order_group_key( group, max_price ) );
-      // use an end iterator to try to avoid expensive price comparison
-      auto end = limit_groups.upper_bound( limit_order_group_key( group, min_price ) );
-      while( itr != end && result.size() < limit )
-      {
-         result.emplace_back( *itr );
-         ++itr;
-      }
+      const auto groups = book->get_groups( max_price, limit );
+      result.reserve( groups.size() );
+      for( const auto& data : groups )
+         result.emplace_back( data );
       return result;
    }
 
@@ -1088,4 +1087,102 @@ namespace graphene { namespace app {
 
    }
 
+   custom_operations_api::storage_page custom_operations_api::get_storage_by_key_range(
+         const std::string& account_name_or_id,
+         const std::string& catalog,
+         const optional<std::string>& lower_key,
+         const optional<std::string>& upper_key,
+         const optional<uint32_t>& olimit )const
+   {
+      auto plugin = _app.get_plugin<graphene::custom_operations::custom_operations_plugin>("custom_operations");
+      FC_ASSERT( plugin, "The custom_operations plugin is not enabled" );
+
+      const auto configured_limit = _app.get_options().api_limit_get_storage_info;
+      uint32_t limit = olimit.valid() ? *olimit : configured_limit;
+      FC_ASSERT( limit <= configured_limit,
+                 "limit can not be greater than ${configured_limit}",
+                 ("configured_limit", configured_limit) );
+
+      database_api_helper db_api_helper( _app );
+      const account_id_type account_id = db_api_helper.get_account_from_string( account_name_or_id )->get_id();
+
+      storage_page result;
+      if( lower_key.valid() && upper_key.valid() && *lower_key >= *upper_key )
+         return result;
+
+      const auto& idx = _app.chain_database()->get_index_type<account_storage_index>().indices()
+                                                 .get<by_account_catalog_key>();
+      auto itr = lower_key.valid() ? idx.lower_bound( std::make_tuple( account_id, catalog, *lower_key ) )
+                                   : idx.lower_bound( std::make_tuple( account_id, catalog ) );
+      auto end = upper_key.valid() ? idx.lower_bound( std::make_tuple( account_id, catalog, *upper_key ) )
+                                   : idx.upper_bound( std::make_tuple( account_id, catalog ) );
+
+      // Stop at the end of the account and catalog too, even if the range is wrong
+      const auto in_range = [&]( decltype(itr) it ) {
+         return it != end && it != idx.end() && it->account == account_id && it->catalog == catalog;
+      };
+      result.objects.reserve( limit );
+      for( ; in_range( itr ) && result.objects.size() < limit; ++itr )
+         result.objects.push_back( *itr );
+      if( in_range( itr ) )
+         result.next_key = itr->key;
+      return result;
+   }
+
+   custom_operations_api::storage_page custom_operations_api::get_storage_by_key_prefix(
+         const std::string& account_name_or_id,
+         const std::string& catalog,
+         const std::string& key_prefix,
+         const optional<std::string>& start_key,
+         const optional<uint32_t>& limit )const
+   {
+      // the keys starting with the prefix are in [ prefix, successor of prefix )
+      optional<std::string> upper_key;
+      std::string successor = key_prefix;
+      while( !successor.empty() && static_cast<unsigned char>( successor.back() ) == 0xFF )
+         successor.pop_back();
+      if( !successor.empty() )
+      {
+         successor.back() = static_cast<char>( static_cast<unsigned char>( successor.back() ) + 1 );
+         upper_key = std::move( successor );
+      }
+
+      std::string lower_key = key_prefix;
+      if( start_key.valid() && *start_key > lower_key )
+         lower_key = *start_key;
+
+      return get_storage_by_key_range( account_name_or_id, catalog, lower_key, upper_key, limit );
+   }
+
+   vector<optional<account_storage_object>> custom_operations_api::get_storage_by_keys(
+         const std::string& account_name_or_id,
+         const std::string& catalog,
+         const vector<std::string>& keys )const
+   {
+      auto plugin = _app.get_plugin<graphene::custom_operations::custom_operations_plugin>("custom_operations");
+      FC_ASSERT( plugin, "The custom_operations plugin is not enabled" );
+
+      const auto configured_limit = _app.get_options().api_limit_get_storage_info;
+      FC_ASSERT( keys.size() <= configured_limit,
+                 "Number of querying keys can not be greater than ${configured_limit}",
+                 ("configured_limit", configured_limit) );
+
+      database_api_helper db_api_helper( _app );
+      const account_id_type account_id = db_api_helper.get_account_from_string( account_name_or_id )->get_id();
+
+      const auto& idx = _app.chain_database()->get_index_type<account_storage_index>().indices()
+                                                 .get<by_account_catalog_key>();
+      vector<optional<account_storage_object>> result;
+      result.reserve( keys.size() );
+      for( const auto& key : keys )
+      {
+         auto itr = idx.find( std::make_tuple( account_id, catalog, key ) );
+         if( itr != idx.end() )
+            result.emplace_back( *itr );
+         else
+            result.emplace_back();
+      }
+      return result;
+   }
+
 } } // graphene::app
@@ -28,6 +28,7 @@
 
 #include <graphene/chain/db_with.hpp>
 #include <graphene/chain/genesis_state.hpp>
+#include <graphene/chain/replay_profiler.hpp>
 #include <graphene/protocol/fee_schedule.hpp>
 #include <graphene/protocol/types.hpp>
 
@@ -41,6 +42,7 @@
 
 #include <fc/asio.hpp>
 #include <fc/io/fstream.hpp>
+#include <fc/io/raw.hpp>
 #include <fc/rpc/api_connection.hpp>
 #include <fc/rpc/websocket_api.hpp>
 #include <fc/crypto/base64.hpp>
@@ -50,6 +52,7 @@
 #include <boost/range/algorithm/reverse.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <fstream>
 #include <iostream>
 
 #include <fc/log/file_appender.hpp>
@@ -474,6 +477,10 @@ void application_impl::set_api_limit() {
       _app_options.api_limit_get_storage_info =
             _options->at("api-limit-get-storage-info").as<uint32_t>();
    }
+   if(_options->count("api-limit-get-signatures-batch") > 0) {
+      _app_options.api_limit_get_signatures_batch =
+            _options->at("api-limit-get-signatures-batch").as<uint32_t>();
+   }
 }
 
 graphene::chain::genesis_state_type application_impl::initialize_genesis_state() const
@@ -482,9 +489,9 @@ graphene::chain::genesis_state_type application_impl::initialize_genesis_state()
       ilog("Initializing database...");
       if( _options->count("genesis-json") > 0 )
       {
-         std::string genesis_str;
-         fc::read_file_contents( _options->at("genesis-json").as<boost::filesystem::path>(), genesis_str );
-         auto genesis = fc::json::from_string( genesis_str ).as<graphene::chain::genesis_state_type>( 20 );
+         const fc::path genesis_file = _options->at("genesis-json").as<boost::filesystem::path>();
+         // Large genesis files are neither loaded as a whole nor parsed into a variant tree
+         auto genesis = graphene::chain::read_genesis_state_from_file( genesis_file, 20 );
          bool modified_genesis = false;
          if( _options->count("genesis-timestamp") > 0 )
          {
@@ -508,12 +515,23 @@ graphene::chain::genesis_state_type application_impl::initialize_genesis_state()
             modified_genesis = true;
             ilog("Set init witness key to ${init_key}", ("init_key", init_key));
          }
+         fc::sha256::encoder chain_id_encoder;
+         {
+            std::ifstream in( genesis_file.generic_string().c_str(), std::ios::in | std::ios::binary );
+            FC_ASSERT( in.good(), "Unable to open ${f}", ("f", genesis_file) );
+            std::vector<char> buffer( 1 << 20 );
+            while( in )
+            {
+               in.read( buffer.data(), buffer.size() );
+               chain_id_encoder.write( buffer.data(), static_cast<uint32_t>( in.gcount() ) );
+            }
+         }
          if( modified_genesis )
          {
             wlog("WARNING:  GENESIS WAS MODIFIED, YOUR CHAIN ID MAY BE DIFFERENT");
-            genesis_str += "BOGUS";
+            chain_id_encoder.write( "BOGUS", 5 );
          }
-         genesis.initial_chain_id = fc::sha256::hash( genesis_str );
+         genesis.initial_chain_id = chain_id_encoder.result();
          return genesis;
       }
       else
@@ -554,9 +572,21 @@ void application_impl::open_chain_database() const
       _chain_db->enable_standby_votes_tracking( _options->at("enable-standby-votes-tracking").as<bool>() );
    }
 
+   if( _options->count("store-operation-log") > 0 )
+   {
+      _chain_db->enable_operation_log( _options->at("store-operation-log").as<bool>() );
+   }
+
    if( _options->count("replay-blockchain") > 0 || _options->count("revalidate-blockchain") > 0 )
       _chain_db->wipe( _data_dir / "blockchain", false );
 
+   if( _options->count("replay-profile") > 0 )
+   {
+      _chain_db->set_replay_profiler( std::make_shared<graphene::chain::replay_profiler>(
+            fc::path( _options->at("replay-profile").as<string>() ),
+            _options->at("replay-profile-interval").as<uint32_t>() ) );
+   }
+
    try
    {
       // these flags are used in open() only, i. e. during replay
@@ -589,9 +619,11 @@ void application_impl::open_chain_database() const
    }
    catch( const fc::exception& e )
    {
+      _chain_db->set_replay_profiler( nullptr );
       elog( "Caught exception ${e} in open(), you might want to force a replay", ("e", e.to_detail_string()) );
       throw;
    }
+   _chain_db->set_replay_profiler( nullptr );
 } FC_LOG_AND_RETHROW() }
 
 void application_impl::startup()
@@ -604,6 +636,9 @@ void application_impl::startup()
 
    startup_plugins();
 
+   if( _options->count("replay-plugins") > 0 )
+      replay_plugins();
+
    if( enable_p2p_network && _active_plugins.find( "delayed_node" ) == _active_plugins.end() )
       reset_p2p_node(_data_dir);
 
@@ -824,13 +859,22 @@ message application_impl::get_item(const item_id& id)
   // ilog("Request for item ${id}", ("id", id));
    if( id.item_type == graphene::net::block_message_type )
    {
-      auto opt_block = _chain_db->fetch_block_by_id(id.item_hash);
+      auto opt_block = _chain_db->fetch_block_view_by_id(id.item_hash);
       if( !opt_block )
          elog("Couldn't find block ${id} -- corresponding ID in our chain is ${id2}",
               ("id", id.item_hash)("id2", _chain_db->get_block_id_for_num(block_header::num_from_id(id.item_hash))));
       FC_ASSERT( opt_block.valid() );
-      // ilog("Serving up block #${num}", ("num", opt_block->block_num()));
-      return block_message(std::move(*opt_block));
+      // ilog("Serving up block #${num}", ("num", opt_block->header().block_num()));
+      // A packed block message is the packed block followed by the block ID, so the block is sent without
+      // unpacking and repacking it
+      message result;
+      result.msg_type = block_message::type;
+      result.data.reserve( opt_block->packed().size() + sizeof(block_id_type) );
+      result.data = opt_block->packed();
+      const auto packed_id = fc::raw::pack( id.item_hash );
+      result.data.insert( result.data.end(), packed_id.begin(), packed_id.end() );
+      result.size = static_cast<uint32_t>( result.data.size() );
+      return result;
    }
    return trx_message( _chain_db->get_recent_transaction( id.item_hash ) );
 } FC_CAPTURE_AND_RETHROW( (id) ) } // GCOVR_EXCL_LINE
@@ -1134,6 +1178,23 @@ void application_impl::startup_plugins() const
    }
 }
 
+void application_impl::replay_plugins() const
+{
+   vector<std::shared_ptr<abstract_plugin>> plugins;
+   for( const string& name : _options->at("replay-plugins").as<vector<string>>() )
+   {
+      auto itr = _active_plugins.find( name );
+      FC_ASSERT( itr != _active_plugins.end(), "Plugin '${p}' to replay is not enabled", ("p", name) );
+      plugins.push_back( itr->second );
+   }
+   ilog( "Replaying plugins ${p} from the operation log", ("p", _options->at("replay-plugins").as<vector<string>>()) );
+   _chain_db->replay_operation_log( [&plugins]( const graphene::chain::signed_block& b ) {
+      for( const auto& p : plugins )
+         p->plugin_replay_block( b );
+   });
+   _chain_db->flush();
+}
+
 void application_impl::shutdown_plugins() const
 {
    for( const auto& entry : _active_plugins )
@@ -1226,6 +1287,9 @@ void application::set_program_options(boost::program_options::options_descriptio
          ("enable-standby-votes-tracking", bpo::value<bool>()->implicit_value(true),
           "Whether to enable tracking of votes of standby witnesses and committee members. "
           "Set it to true to provide accurate data to API clients, set to false for slightly better performance.")
+         ("store-operation-log", bpo::value<bool>()->implicit_value(true),
+          "Whether to store the operations applied in each block next to the block log, "
+          "so that plugins can be rebuilt with replay-plugins instead of a full replay")
          ("api-limit-get-account-history-operations",
           bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_account_history_operations),
           "For history_api::get_account_history_operations to set max limit value")
@@ -1337,6 +1401,9 @@ void application::set_program_options(boost::program_options::options_descriptio
          ("api-limit-get-storage-info",
           bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_storage_info),
           "Set maximum limit value for APIs which query for account storage info")
+         ("api-limit-get-signatures-batch",
+          bpo::value<uint32_t>()->default_value(default_opts.api_limit_get_signatures_batch),
+          "Set maximum number of transactions in database APIs which query for signatures of many transactions")
          ;
    command_line_options.add(configuration_file_options);
    command_line_options.add_options()
@@ -1344,6 +1411,15 @@ void application::set_program_options(boost::program_options::options_descriptio
          ("revalidate-blockchain", "Rebuild object graph by replaying all blocks with full validation")
          ("resync-blockchain", "Delete all blocks and re-sync with network from scratch")
          ("force-validate", "Force validation of all transactions during normal operation")
+         ("replay-profile", bpo::value<string>(),
+          "Record the throughput, time per operation type, maintenance time, plugin time and undo history size "
+          "of each range of replayed blocks to this file, as JSON lines, or as CSV if the name ends with .csv")
+         ("replay-profile-interval", bpo::value<uint32_t>()->default_value(10000),
+          "Number of blocks in each range recorded by replay-profile")
+         ("replay-plugins", bpo::value<vector<string>>()->composing(),
+          "Rebuild the state of the listed plugins from the stored operation log without replaying the blockchain. "
+          "The plugin state must be empty, e.g. when a plugin is enabled for the first time. "
+          "Requires store-operation-log to have been enabled since the first block")
          ("genesis-timestamp", bpo::value<uint32_t>(),
           "Replace timestamp from genesis.json with current time plus this many seconds (experts only!)")
          ;
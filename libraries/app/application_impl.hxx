@@ -200,6 +200,8 @@ class application_impl : public net::node_delegate, public std::enable_shared_fr
       void initialize_plugins() const;
       void startup_plugins() const;
       void shutdown_plugins() const;
+      /// Rebuild the state of the plugins listed in the replay-plugins option from the operation log
+      void replay_plugins() const;
 
       /// Initialize genesis state. Called by open_chain_database().
       graphene::chain::genesis_state_type initialize_genesis_state() const;
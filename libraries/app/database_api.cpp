@@ -248,7 +248,7 @@ optional<maybe_signed_block_header> database_api::get_block_header(
 optional<maybe_signed_block_header> database_api_impl::get_block_header(
             uint32_t block_num, bool with_witness_signature )const
 {
-   auto result = _db.fetch_block_by_number(block_num);
+   auto result = _db.fetch_block_header_by_number(block_num);
    if(result)
       return maybe_signed_block_header( *result, with_witness_signature );
    return {};
@@ -298,10 +298,9 @@ optional<signed_transaction> database_api::get_recent_transaction_by_id( const t
 
 processed_transaction database_api_impl::get_transaction(uint32_t block_num, uint32_t trx_num)const
 {
-   auto opt_block = _db.fetch_block_by_number(block_num);
-   FC_ASSERT( opt_block );
-   FC_ASSERT( opt_block->transactions.size() > trx_num );
-   return opt_block->transactions[trx_num];
+   auto opt_trx = _db.fetch_transaction_by_number( block_num, trx_num );
+   FC_ASSERT( opt_trx );
+   return *opt_trx;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -1820,18 +1819,18 @@ vector<extended_liquidity_pool_object> database_api_impl::get_liquidity_pools_by
    asset_id_type aid = get_asset_from_string(asset_symbol_or_id)->get_id();
 
    FC_ASSERT( asset_in_liquidity_pools_index, "Internal error" );
-   const auto& pools = asset_in_liquidity_pools_index->get_liquidity_pools_by_asset( aid );
+   const auto pools = asset_in_liquidity_pools_index->get_liquidity_pools_by_asset( aid );
 
    liquidity_pool_id_type start_id = ostart_id.valid() ? *ostart_id : liquidity_pool_id_type();
 
-   auto itr = pools.lower_bound( start_id );
+   auto itr = pools->lower_bound( start_id );
 
    bool with_stats = ( with_statistics.valid() && *with_statistics );
 
    vector<extended_liquidity_pool_object> results;
 
    results.reserve( limit );
-   while( itr != pools.end() && results.size() < limit )
+   while( itr != pools->end() && results.size() < limit )
    {
       results.emplace_back( extend_liquidity_pool( (*itr)(_db), with_stats ) );
       ++itr;
@@ -2550,6 +2549,51 @@ set<address> database_api::get_potential_address_signatures( const signed_transa
    return my->get_potential_address_signatures( trx );
 }
 
+vector<set<public_key_type>> database_api::get_required_signatures_batch( const vector<signed_transaction>& trxs,
+                                                       const flat_set<public_key_type>& available_keys )const
+{
+   return my->get_required_signatures_batch( trxs, available_keys );
+}
+
+vector<set<public_key_type>> database_api_impl::get_required_signatures_batch(
+                                                       const vector<signed_transaction>& trxs,
+                                                       const flat_set<public_key_type>& available_keys )const
+{
+   FC_ASSERT( _app_options, "Internal error" );
+   const auto configured_limit = _app_options->api_limit_get_signatures_batch;
+   FC_ASSERT( trxs.size() <= configured_limit,
+              "Number of transactions can not be greater than ${configured_limit}",
+              ("configured_limit", configured_limit) );
+
+   vector<set<public_key_type>> result;
+   result.reserve( trxs.size() );
+   for( const auto& trx : trxs )
+      result.push_back( get_required_signatures( trx, available_keys ) );
+   return result;
+}
+
+vector<set<public_key_type>> database_api::get_potential_signatures_batch(
+                                                       const vector<signed_transaction>& trxs )const
+{
+   return my->get_potential_signatures_batch( trxs );
+}
+
+vector<set<public_key_type>> database_api_impl::get_potential_signatures_batch(
+                                                       const vector<signed_transaction>& trxs )const
+{
+   FC_ASSERT( _app_options, "Internal error" );
+   const auto configured_limit = _app_options->api_limit_get_signatures_batch;
+   FC_ASSERT( trxs.size() <= configured_limit,
+              "Number of transactions can not be greater than ${configured_limit}",
+              ("configured_limit", configured_limit) );
+
+   vector<set<public_key_type>> result;
+   result.reserve( trxs.size() );
+   for( const auto& trx : trxs )
+      result.push_back( get_potential_signatures( trx ) );
+   return result;
+}
+
 set<public_key_type> database_api_impl::get_potential_signatures( const signed_transaction& trx )const
 {
    auto chain_time = _db.head_block_time();
@@ -188,6 +188,9 @@ class database_api_impl : public std::enable_shared_from_this<database_api_impl>
       set<public_key_type> get_required_signatures( const signed_transaction& trx,
                                                     const flat_set<public_key_type>& available_keys )const;
       set<public_key_type> get_potential_signatures( const signed_transaction& trx )const;
+      vector<set<public_key_type>> get_required_signatures_batch( const vector<signed_transaction>& trxs,
+                                                       const flat_set<public_key_type>& available_keys )const;
+      vector<set<public_key_type>> get_potential_signatures_batch( const vector<signed_transaction>& trxs )const;
       set<address> get_potential_address_signatures( const signed_transaction& trx )const;
       bool verify_authority( const signed_transaction& trx )const;
       bool verify_account_authority( const string& account_name_or_id,
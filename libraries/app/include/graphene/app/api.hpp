@@ -604,10 +604,10 @@ namespace graphene { namespace app {
           */
          struct limit_order_group
          {
-            explicit limit_order_group( const std::pair<limit_order_group_key,limit_order_group_data>& p )
-               :  min_price( p.first.min_price ),
-                  max_price( p.second.max_price ),
-                  total_for_sale( p.second.total_for_sale )
+            explicit limit_order_group( const limit_order_group_data& d )
+               :  min_price( d.min_price ),
+                  max_price( d.max_price ),
+                  total_for_sale( d.total_for_sale )
                   {}
             limit_order_group() = default;
 
@@ -687,6 +687,65 @@ namespace graphene { namespace app {
             const optional<uint32_t>& limit = optional<uint32_t>(),
             const optional<account_storage_id_type>& start_id = optional<account_storage_id_type>() )const;
 
+      /**
+       * @brief A page of stored objects returned by key range queries
+       */
+      struct storage_page
+      {
+         vector<account_storage_object> objects; ///< the stored objects found, sorted by key
+         optional<std::string>          next_key; ///< the key to start the next page with, null if no more data
+      };
+
+      /**
+       * @brief Get stored objects of an account in a catalog whose keys are in a range
+       *
+       * @param account_name_or_id The account name or ID to get info from
+       * @param catalog The catalog to get info from
+       * @param lower_key The lowest key to fetch, inclusive. Optional, if omitted or null, start from the first key
+       * @param upper_key The highest key to fetch, exclusive. Optional, if omitted or null, end with the last key
+       * @param limit The limitation of items each query can fetch, not greater than the configured value of
+       *              @a api_limit_get_storage_info. Optional, if omitted or null, the configured value is used
+       * @return The stored objects found, sorted by key, and the key to pass as @p lower_key to fetch the next page
+       */
+      storage_page get_storage_by_key_range(
+            const std::string& account_name_or_id,
+            const std::string& catalog,
+            const optional<std::string>& lower_key = optional<std::string>(),
+            const optional<std::string>& upper_key = optional<std::string>(),
+            const optional<uint32_t>& limit = optional<uint32_t>() )const;
+
+      /**
+       * @brief Get stored objects of an account in a catalog whose keys start with a prefix
+       *
+       * @param account_name_or_id The account name or ID to get info from
+       * @param catalog The catalog to get info from
+       * @param key_prefix The prefix of keys to fetch, an empty prefix matches all keys in the catalog
+       * @param start_key The key to start with, usually the @a next_key of the previous page. Optional
+       * @param limit The limitation of items each query can fetch, not greater than the configured value of
+       *              @a api_limit_get_storage_info. Optional, if omitted or null, the configured value is used
+       * @return The stored objects found, sorted by key, and the key to pass as @p start_key to fetch the next page
+       */
+      storage_page get_storage_by_key_prefix(
+            const std::string& account_name_or_id,
+            const std::string& catalog,
+            const std::string& key_prefix,
+            const optional<std::string>& start_key = optional<std::string>(),
+            const optional<uint32_t>& limit = optional<uint32_t>() )const;
+
+      /**
+       * @brief Get stored objects of an account in a catalog by keys
+       *
+       * @param account_name_or_id The account name or ID to get info from
+       * @param catalog The catalog to get info from
+       * @param keys The keys to fetch, the quantity can not be greater than the configured value of
+       *             @a api_limit_get_storage_info
+       * @return The stored objects, in the same order as @p keys, null for keys which are not found
+       */
+      vector<optional<account_storage_object>> get_storage_by_keys(
+            const std::string& account_name_or_id,
+            const std::string& catalog,
+            const vector<std::string>& keys )const;
+
    private:
       application& _app;
    };
@@ -819,6 +878,8 @@ FC_REFLECT( graphene::app::history_api::history_operation_detail,
 FC_REFLECT( graphene::app::orders_api::limit_order_group,
             (min_price)(max_price)(total_for_sale) )
 
+FC_REFLECT( graphene::app::custom_operations_api::storage_page, (objects)(next_key) )
+
 FC_REFLECT( graphene::app::asset_api::account_asset_balance, (name)(account_id)(amount) )
 FC_REFLECT( graphene::app::asset_api::asset_holders, (asset_id)(count) )
 
@@ -873,6 +934,9 @@ FC_API(graphene::app::orders_api,
      )
 FC_API(graphene::app::custom_operations_api,
        (get_storage_info)
+       (get_storage_by_key_range)
+       (get_storage_by_key_prefix)
+       (get_storage_by_keys)
      )
 FC_API(graphene::app::dummy_api,
        (dummy)
@@ -1272,6 +1272,24 @@ class database_api
        */
       set<public_key_type> get_potential_signatures( const signed_transaction& trx )const;
 
+      /**
+       *  Batch version of @ref get_required_signatures, for wallets which sign many transactions at once.
+       *
+       *  @param trxs the transactions to be signed, at most @a api_limit_get_signatures_batch
+       *  @param available_keys a set of public keys which may sign any of the transactions
+       *  @return for each transaction, a subset of @p available_keys that could sign for it
+       */
+      vector<set<public_key_type>> get_required_signatures_batch( const vector<signed_transaction>& trxs,
+                                                       const flat_set<public_key_type>& available_keys )const;
+
+      /**
+       *  Batch version of @ref get_potential_signatures, for wallets which sign many transactions at once.
+       *
+       *  @param trxs the transactions to be signed, at most @a api_limit_get_signatures_batch
+       *  @return for each transaction, the set of all public keys that could possibly sign for it
+       */
+      vector<set<public_key_type>> get_potential_signatures_batch( const vector<signed_transaction>& trxs )const;
+
       /**
        *  This method will return the set of all addresses that could possibly sign for a given transaction.
        *
@@ -1591,6 +1609,8 @@ FC_API(graphene::app::database_api,
    (get_transaction_hex_without_sig)
    (get_required_signatures)
    (get_potential_signatures)
+   (get_required_signatures_batch)
+   (get_potential_signatures_batch)
    (get_potential_address_signatures)
    (verify_authority)
    (verify_account_authority)
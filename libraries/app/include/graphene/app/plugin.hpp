@@ -74,6 +74,18 @@ class abstract_plugin
        */
       virtual void plugin_shutdown() = 0;
 
+      /**
+       * @brief Rebuild plugin state from a block which has already been applied.
+       *
+       * This is called by the application for each block of the operation log when the plugin is listed in the
+       * replay-plugins option. It is called after startup(), while database::get_applied_operations() returns the
+       * operations which were applied in the block. Plugins which only depend on blocks and applied operations
+       * should process the block the same way as in their applied_block handler.
+       *
+       * @param b The block to process
+       */
+      virtual void plugin_replay_block( const chain::signed_block& b ) = 0;
+
       /**
        * @brief Fill in command line parameters used by the plugin.
        *
@@ -107,6 +119,7 @@ class plugin : public abstract_plugin
       void plugin_initialize( const boost::program_options::variables_map& options ) override;
       void plugin_startup() override;
       void plugin_shutdown() override;
+      void plugin_replay_block( const chain::signed_block& b ) override;
       void plugin_set_program_options(
          boost::program_options::options_description& command_line_options,
          boost::program_options::options_description& config_file_options
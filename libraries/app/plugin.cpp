@@ -52,6 +52,11 @@ void plugin::plugin_shutdown()
    // nothing to do
 }
 
+void plugin::plugin_replay_block( const chain::signed_block& b )
+{
+   FC_THROW( "Plugin ${p} does not support replaying the operation log", ("p", plugin_name()) );
+}
+
 void plugin::plugin_set_program_options(
    boost::program_options::options_description& command_line_options,
    boost::program_options::options_description& config_file_options
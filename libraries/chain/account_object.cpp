@@ -23,6 +23,8 @@
  */
 #include <graphene/chain/account_object.hpp>
 #include <graphene/chain/database.hpp>
+#include <graphene/chain/global_property_object.hpp>
+#include <graphene/chain/vesting_balance_object.hpp>
 
 #include <fc/io/raw.hpp>
 #include <fc/uint128.hpp>
@@ -50,7 +52,81 @@ void account_balance_object::adjust_balance(const asset& delta)
       maintenance_flag = true;
 }
 
-void account_statistics_object::process_fees(const account_object& a, database& d) const
+void fee_payout_accumulator::add_cashback( const account_object& recipient, share_type amount, bool require_vesting )
+{
+   if( amount == 0 )
+      return;
+
+   const account_id_type acct_id = recipient.get_id();
+   auto itr = _cashback.find( acct_id );
+   if( itr == _cashback.end() )
+   {
+      // Same as in database::deposit_cashback
+      if( database::is_cashback_reserved_account( acct_id ) )
+      {
+         _reserve_cashback += amount;
+         return;
+      }
+
+      // Same as in database::deposit_lazy_vesting, deposits which create a vesting balance are applied right away
+      const uint32_t vesting_seconds = _db.get_global_properties().parameters.cashback_vesting_period_seconds;
+      const vesting_balance_object* vbo = recipient.cashback_vb.valid() ? _db.find( *recipient.cashback_vb )
+                                                                         : nullptr;
+      if( vbo == nullptr || vbo->owner != acct_id || !vbo->policy.is_type< cdd_vesting_policy >()
+            || vbo->policy.get< cdd_vesting_policy >().vesting_seconds != vesting_seconds )
+      {
+         _db.deposit_cashback( recipient, amount, require_vesting );
+         return;
+      }
+      itr = _cashback.emplace( acct_id, pending_cashback{ vbo->get_id(), 0, 0 } ).first;
+   }
+   else
+      ++_merged_payouts;
+
+   if( require_vesting )
+      itr->second.vesting += amount;
+   else
+      itr->second.vested += amount;
+}
+
+void fee_payout_accumulator::apply( account_id_type account )
+{
+   auto itr = _cashback.find( account );
+   if( itr == _cashback.end() )
+      return;
+
+   // All deposits happen at the same time, so depositing the sums gives the same coin seconds as depositing
+   // the amounts one by one
+   const pending_cashback& pending = itr->second;
+   const fc::time_point_sec now = _db.head_block_time();
+   _db.modify( pending.vesting_balance( _db ), [&pending,&now]( vesting_balance_object& vbo )
+   {
+      if( pending.vesting > 0 )
+         vbo.deposit( now, pending.vesting );
+      if( pending.vested > 0 )
+         vbo.deposit_vested( now, pending.vested );
+   } );
+   _cashback.erase( itr );
+}
+
+void fee_payout_accumulator::apply_all()
+{
+   while( !_cashback.empty() )
+      apply( _cashback.begin()->first );
+
+   if( _network_fees != 0 || _reserve_cashback != 0 )
+   {
+      _db.modify( _db.get_core_dynamic_data(), [this]( asset_dynamic_data_object& addo ) {
+         addo.accumulated_fees += _network_fees;
+         addo.current_supply -= _reserve_cashback;
+      });
+      _network_fees = 0;
+      _reserve_cashback = 0;
+   }
+}
+
+void account_statistics_object::process_fees(const account_object& a, database& d,
+                                             fee_payout_accumulator* payouts) const
 {
    if( pending_fees > 0 || pending_vested_fees > 0 )
    {
@@ -69,19 +145,28 @@ void account_statistics_object::process_fees(const account_object& a, database&
          share_type lifetime_cut = cut_fee(core_fee_total, account.lifetime_referrer_fee_percentage);
          share_type referral = core_fee_total - network_cut - lifetime_cut;
 
-         d.modify( d.get_core_dynamic_data(), [network_cut](asset_dynamic_data_object& addo) {
-            addo.accumulated_fees += network_cut;
-         });
-
          // Potential optimization: Skip some of this math and object lookups by special casing on the account type.
          // For example, if the account is a lifetime member, we can skip all this and just deposit the referral to
          // it directly.
          share_type referrer_cut = cut_fee(referral, account.referrer_rewards_percentage);
          share_type registrar_cut = referral - referrer_cut;
 
-         d.deposit_cashback(d.get(account.lifetime_referrer), lifetime_cut, require_vesting);
-         d.deposit_cashback(d.get(account.referrer), referrer_cut, require_vesting);
-         d.deposit_cashback(d.get(account.registrar), registrar_cut, require_vesting);
+         if( payouts != nullptr )
+         {
+            payouts->add_network_fee( network_cut );
+            payouts->add_cashback( d.get(account.lifetime_referrer), lifetime_cut, require_vesting );
+            payouts->add_cashback( d.get(account.referrer), referrer_cut, require_vesting );
+            payouts->add_cashback( d.get(account.registrar), registrar_cut, require_vesting );
+         }
+         else
+         {
+            d.modify( d.get_core_dynamic_data(), [network_cut](asset_dynamic_data_object& addo) {
+               addo.accumulated_fees += network_cut;
+            });
+            d.deposit_cashback(d.get(account.lifetime_referrer), lifetime_cut, require_vesting);
+            d.deposit_cashback(d.get(account.referrer), referrer_cut, require_vesting);
+            d.deposit_cashback(d.get(account.registrar), registrar_cut, require_vesting);
+         }
 
          assert( referrer_cut + registrar_cut + network_cut + lifetime_cut == core_fee_total );
       };
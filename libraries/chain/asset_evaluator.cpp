@@ -1629,5 +1629,7 @@ void_result asset_claim_pool_evaluator::do_apply( const asset_claim_pool_operati
     return void_result();
 } FC_CAPTURE_AND_RETHROW( (o) ) } // GCOVR_EXCL_LINE
 
+template operation_result evaluate_operation<asset_publish_feeds_evaluator>( transaction_evaluation_state&,
+                                                                             const operation&, bool );
 
 } } // graphene::chain
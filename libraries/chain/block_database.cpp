@@ -24,8 +24,11 @@
 #include <graphene/chain/block_database.hpp>
 #include <graphene/protocol/fee_schedule.hpp>
 #include <fc/io/raw.hpp>
+#include <fc/interprocess/file_mapping.hpp>
 #include <boost/endian/buffers.hpp>
 
+#include <cstring>
+
 namespace graphene { namespace chain {
 
 struct index_entry
@@ -151,26 +154,12 @@ block_id_type block_database::fetch_block_id( uint32_t block_num )const
 
 optional<signed_block> block_database::fetch_optional( const block_id_type& id )const
 {
+   auto view = fetch_view( block_header::num_from_id(id) );
+   if( !view.valid() || view->header().id() != id )
+      return optional<signed_block>();
    try
    {
-      index_entry e;
-      int64_t index_pos = sizeof(e) * int64_t(block_header::num_from_id(id));
-      _block_num_to_pos.seekg( 0, _block_num_to_pos.end );
-      if ( _block_num_to_pos.tellg() <= index_pos )
-         return {};
-
-      _block_num_to_pos.seekg( index_pos );
-      _block_num_to_pos.read( (char*)&e, sizeof(e) );
-
-      if( e.block_id != id ) return optional<signed_block>();
-
-      vector<char> data( e.block_size.value() );
-      _blocks.seekg( e.block_pos.value() );
-      if (e.block_size.value())
-         _blocks.read( data.data(), e.block_size.value() );
-      auto result = fc::raw::unpack<signed_block>(data);
-      FC_ASSERT( result.id() == e.block_id );
-      return result;
+      return view->block();
    }
    catch (const fc::exception&)
    {
@@ -182,6 +171,24 @@ optional<signed_block> block_database::fetch_optional( const block_id_type& id )
 }
 
 optional<signed_block> block_database::fetch_by_number( uint32_t block_num )const
+{
+   auto view = fetch_view( block_num );
+   if( !view.valid() )
+      return optional<signed_block>();
+   try
+   {
+      return view->block();
+   }
+   catch (const fc::exception&)
+   {
+   }
+   catch (const std::exception&)
+   {
+   }
+   return optional<signed_block>();
+}
+
+optional<signed_block_view> block_database::fetch_view( uint32_t block_num )const
 {
    try
    {
@@ -196,9 +203,10 @@ optional<signed_block> block_database::fetch_by_number( uint32_t block_num )cons
 
       vector<char> data( e.block_size.value() );
       _blocks.seekg( e.block_pos.value() );
-      _blocks.read( data.data(), e.block_size.value() );
-      auto result = fc::raw::unpack<signed_block>(data);
-      FC_ASSERT( result.id() == e.block_id );
+      if (e.block_size.value())
+         _blocks.read( data.data(), e.block_size.value() );
+      signed_block_view result( std::move(data) );
+      FC_ASSERT( result.header().id() == e.block_id );
       return result;
    }
    catch (const fc::exception&)
@@ -207,7 +215,7 @@ optional<signed_block> block_database::fetch_by_number( uint32_t block_num )cons
    catch (const std::exception&)
    {
    }
-   return optional<signed_block>();
+   return optional<signed_block_view>();
 }
 
 optional<index_entry> block_database::last_index_entry()const {
@@ -238,8 +246,8 @@ optional<index_entry> block_database::last_index_entry()const {
                _blocks.read( data.data(), e.block_size.value() );
                if( _blocks.gcount() == long(e.block_size.value()) )
                {
-                  const signed_block block = fc::raw::unpack<signed_block>(data);
-                  if( block.id() == e.block_id )
+                  const signed_block_view block( std::move(data) );
+                  if( block.header().id() == e.block_id )
                      return e;
                }
             }
@@ -286,4 +294,67 @@ size_t block_database::total_block_size()const
    return (size_t)_blocks.tellg();
 }
 
+struct mapped_block_database::mapped_file
+{
+   explicit mapped_file( const fc::path& filename )
+   : size( fc::exists( filename ) ? fc::file_size( filename ) : 0 )
+   {
+      if( size == 0 )
+         return;
+      mapping.reset( new fc::file_mapping( filename.generic_string().c_str(), fc::read_only ) );
+      region.reset( new fc::mapped_region( *mapping, fc::read_only, 0, size ) );
+      data = (const char*)region->get_address();
+   }
+
+   uint64_t                           size;
+   const char*                        data = nullptr;
+   std::unique_ptr<fc::file_mapping>  mapping;
+   std::unique_ptr<fc::mapped_region> region;
+};
+
+mapped_block_database::mapped_block_database( const fc::path& dbdir )
+{ try {
+   FC_ASSERT( fc::exists( dbdir / "index" ) && fc::exists( dbdir / "blocks" ),
+              "No block database found in ${d}", ("d", dbdir) );
+   _index.reset( new mapped_file( dbdir / "index" ) );
+   _blocks.reset( new mapped_file( dbdir / "blocks" ) );
+} FC_CAPTURE_AND_RETHROW( (dbdir) ) }
+
+mapped_block_database::~mapped_block_database() = default;
+
+uint32_t mapped_block_database::last_block_num()const
+{
+   const uint64_t entries = _index->size / sizeof(index_entry);
+   return entries == 0 ? 0 : uint32_t( entries - 1 );
+}
+
+optional<signed_block_view> mapped_block_database::fetch_view( uint32_t block_num )const
+{
+   try
+   {
+      const uint64_t index_pos = sizeof(index_entry) * uint64_t(block_num);
+      if( index_pos + sizeof(index_entry) > _index->size )
+         return {};
+
+      index_entry e;
+      std::memcpy( (char*)&e, _index->data + index_pos, sizeof(e) );
+      const uint64_t block_pos = e.block_pos.value();
+      const uint32_t block_size = e.block_size.value();
+      if( block_size == 0 || block_pos + block_size > _blocks->size )
+         return {};
+
+      signed_block_view result( vector<char>( _blocks->data + block_pos, _blocks->data + block_pos + block_size ) );
+      if( result.header().id() != e.block_id )
+         return {};
+      return result;
+   }
+   catch (const fc::exception&)
+   {
+   }
+   catch (const std::exception&)
+   {
+   }
+   return optional<signed_block_view>();
+}
+
 } }
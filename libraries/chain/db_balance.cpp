@@ -199,6 +199,16 @@ optional< vesting_balance_id_type > database::deposit_lazy_vesting(
    return vbo.id;
 }
 
+bool database::is_cashback_reserved_account( account_id_type acct_id )
+{
+   // Note: missing 'PROXY_TO_SELF' here
+   bool is_reserved_account = ( acct_id == GRAPHENE_COMMITTEE_ACCOUNT || acct_id == GRAPHENE_WITNESS_ACCOUNT ||
+                                acct_id == GRAPHENE_RELAXED_COMMITTEE_ACCOUNT );
+   is_reserved_account = ( is_reserved_account || acct_id == GRAPHENE_NULL_ACCOUNT ||
+                           acct_id == GRAPHENE_TEMP_ACCOUNT );
+   return is_reserved_account;
+}
+
 void database::deposit_cashback(const account_object& acct, share_type amount, bool require_vesting)
 {
    // If we don't have a VBO, or if it has the wrong maturity
@@ -209,12 +219,7 @@ void database::deposit_cashback(const account_object& acct, share_type amount, b
 
    account_id_type acct_id = acct.get_id();
 
-   // Note: missing 'PROXY_TO_SELF' here
-   bool is_reserved_account = ( acct_id == GRAPHENE_COMMITTEE_ACCOUNT || acct_id == GRAPHENE_WITNESS_ACCOUNT ||
-                                acct_id == GRAPHENE_RELAXED_COMMITTEE_ACCOUNT );
-   is_reserved_account = ( is_reserved_account || acct_id == GRAPHENE_NULL_ACCOUNT ||
-                           acct_id == GRAPHENE_TEMP_ACCOUNT );
-   if( is_reserved_account )
+   if( is_cashback_reserved_account( acct_id ) )
    {
       // The blockchain's accounts do not get cashback; it simply goes to the reserve pool.
       modify( get_core_dynamic_data(), [amount](asset_dynamic_data_object& d) {
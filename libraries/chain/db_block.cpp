@@ -31,6 +31,7 @@
 #include <graphene/chain/operation_history_object.hpp>
 
 #include <graphene/chain/proposal_object.hpp>
+#include <graphene/chain/replay_profiler.hpp>
 #include <graphene/chain/samet_fund_object.hpp>
 #include <graphene/chain/transaction_history_object.hpp>
 #include <graphene/chain/witness_object.hpp>
@@ -43,6 +44,9 @@
 #include <fc/io/raw.hpp>
 #include <fc/thread/parallel.hpp>
 
+#include <atomic>
+#include <memory>
+
 namespace graphene { namespace chain {
 
 bool database::is_known_block( const block_id_type& id )const
@@ -73,6 +77,17 @@ optional<signed_block> database::fetch_block_by_id( const block_id_type& id )con
    return b->data;
 }
 
+optional<signed_block_view> database::fetch_block_view_by_id( const block_id_type& id )const
+{
+   auto b = _fork_db.fetch_block( id );
+   if( b )
+      return signed_block_view( fc::raw::pack( b->data ) );
+   auto view = _block_id_to_block.fetch_view( block_header::num_from_id(id) );
+   if( view.valid() && view->header().id() == id )
+      return view;
+   return optional<signed_block_view>();
+}
+
 optional<signed_block> database::fetch_block_by_number( uint32_t num )const
 {
    auto results = _fork_db.fetch_block_by_number(num);
@@ -82,6 +97,34 @@ optional<signed_block> database::fetch_block_by_number( uint32_t num )const
       return _block_id_to_block.fetch_by_number(num);
 }
 
+optional<signed_block_header> database::fetch_block_header_by_number( uint32_t num )const
+{
+   auto results = _fork_db.fetch_block_by_number(num);
+   if( results.size() == 1 )
+      return optional<signed_block_header>( static_cast<const signed_block_header&>( results[0]->data ) );
+   auto view = _block_id_to_block.fetch_view(num);
+   if( view.valid() )
+      return view->header();
+   return optional<signed_block_header>();
+}
+
+optional<processed_transaction> database::fetch_transaction_by_number( uint32_t block_num,
+                                                                       uint32_t trx_in_block )const
+{
+   auto results = _fork_db.fetch_block_by_number(block_num);
+   if( results.size() == 1 )
+   {
+      const auto& transactions = results[0]->data.transactions;
+      if( trx_in_block < transactions.size() )
+         return transactions[trx_in_block];
+      return optional<processed_transaction>();
+   }
+   auto view = _block_id_to_block.fetch_view(block_num);
+   if( view.valid() && trx_in_block < view->transaction_count() )
+      return view->transaction( trx_in_block );
+   return optional<processed_transaction>();
+}
+
 const signed_transaction& database::get_recent_transaction(const transaction_id_type& trx_id) const
 {
    auto& index = get_index_type<transaction_index>().indices().get<by_trx_id>();
@@ -464,7 +507,7 @@ signed_block database::_generate_block(
          processed_transaction ptx = _apply_transaction( tx );
          // Clear results to save disk space and network bandwidth.
          // This may break client applications which rely on the results.
-         ptx.operation_results.clear();
+         ptx.set_operation_results( vector<operation_result>() );
 
          // We have to recompute pack_size(ptx) because it may be different
          // than pack_size(tx) (i.e. if one or more results increased
@@ -532,6 +575,8 @@ void database::pop_block()
       fork_db_head = _fork_db.fetch_block( head_block_id() );
       FC_ASSERT( fork_db_head, "Trying to pop() block that's not in fork database!?" );
    }
+   if( _operation_log.is_open() )
+      _operation_log.truncate( head_block_num() );
    pop_undo();
    _popped_tx.insert( _popped_tx.begin(),
                       fork_db_head->data.transactions.begin(),
@@ -595,10 +640,11 @@ void database::_apply_block( const signed_block& next_block )
    uint32_t next_block_num = next_block.block_num();
    uint32_t skip = get_node_properties().skip_flags;
    _applied_ops.clear();
+   _authority_cache.clear();
 
    if( 0 == (skip & skip_block_size_check) )
    {
-      FC_ASSERT( fc::raw::pack_size(next_block) <= get_global_properties().parameters.maximum_block_size );
+      FC_ASSERT( next_block.get_packed_size() <= get_global_properties().parameters.maximum_block_size );
    }
 
    FC_ASSERT( (skip & skip_merkle_check) || next_block.transaction_merkle_root == next_block.calculate_merkle_root(),
@@ -634,7 +680,9 @@ void database::_apply_block( const signed_block& next_block )
        * for transactions when validating broadcast transactions or
        * when building a block.
        */
-      trx.operation_results = apply_transaction( trx, skip ).operation_results;
+      vector<operation_result> results;
+      _apply_transaction( trx, results );
+      trx.set_operation_results( std::move( results ) );
       ++_current_trx_in_block;
    }
 
@@ -650,7 +698,12 @@ void database::_apply_block( const signed_block& next_block )
 
    // Are we at the maintenance interval?
    if( maint_needed )
+   {
+      const auto maintenance_start = fc::time_point::now();
       perform_chain_maintenance( next_block );
+      if( _replay_profiler )
+         _replay_profiler->add_maintenance_time( fc::time_point::now() - maintenance_start );
+   }
 
    create_block_summary(next_block);
    clear_expired_transactions();
@@ -673,11 +726,19 @@ void database::_apply_block( const signed_block& next_block )
    if( !_node_property_object.debug_updates.empty() )
       apply_debug_updates();
 
+   if( _operation_log.is_open() )
+      _operation_log.store( next_block_num, _applied_ops );
+
+   const fc::time_point observers_start = _replay_profiler ? fc::time_point::now() : fc::time_point();
+
    // notify observers that the block has been applied
    notify_applied_block( processed_block ); //emit
    _applied_ops.clear();
 
    notify_changed_objects();
+
+   if( _replay_profiler )
+      _replay_profiler->add_observer_time( fc::time_point::now() - observers_start );
 } FC_CAPTURE_AND_RETHROW( (next_block.block_num()) )  } // GCOVR_EXCL_LINE
 
 /**
@@ -696,6 +757,13 @@ processed_transaction database::apply_transaction(const signed_transaction& trx,
 }
 
 processed_transaction database::_apply_transaction(const signed_transaction& trx)
+{
+   processed_transaction ptrx(trx);
+   _apply_transaction( trx, ptrx.operation_results );
+   return ptrx;
+}
+
+void database::_apply_transaction( const signed_transaction& trx, vector<operation_result>& results )
 { try {
    uint32_t skip = get_node_properties().skip_flags;
 
@@ -725,7 +793,7 @@ processed_transaction database::_apply_transaction(const signed_transaction& trx
 
       trx.verify_authority(chain_id, get_active, get_owner, get_custom, allow_non_immediate_owner,
                            MUST_IGNORE_CUSTOM_OP_REQD_AUTHS(head_block_time()),
-                           get_global_properties().parameters.max_authority_depth);
+                           get_global_properties().parameters.max_authority_depth, &_authority_cache);
    }
 
    //Skip all manner of expiration and TaPoS checking if we're on block 1; It's impossible that the transaction is
@@ -763,22 +831,20 @@ processed_transaction database::_apply_transaction(const signed_transaction& trx
    eval_state.operation_results.reserve(trx.operations.size());
 
    //Finally process the operations
-   processed_transaction ptrx(trx);
    _current_op_in_trx = 0;
-   for( const auto& op : ptrx.operations )
+   for( const auto& op : trx.operations )
    {
       _current_virtual_op = 0;
+      eval_state.current_op_packed_size = trx.get_operation_packed_size( _current_op_in_trx );
       eval_state.operation_results.emplace_back(apply_operation(eval_state, op, false)); // This is NOT a virtual op
       ++_current_op_in_trx;
    }
-   ptrx.operation_results = std::move(eval_state.operation_results);
+   results = std::move(eval_state.operation_results);
 
    // Make sure there is no unpaid samet fund debt
    const auto& samet_fund_idx = get_index_type<samet_fund_index>().indices().get<by_unpaid>();
    FC_ASSERT( samet_fund_idx.empty() || samet_fund_idx.begin()->unpaid_amount == 0,
               "Unpaid SameT Fund debt detected" );
-
-   return ptrx;
 } FC_CAPTURE_AND_RETHROW( (trx) ) } // GCOVR_EXCL_LINE
 
 operation_result database::apply_operation( transaction_evaluation_state& eval_state, const operation& op,
@@ -788,10 +854,11 @@ operation_result database::apply_operation( transaction_evaluation_state& eval_s
    uint64_t u_which = uint64_t( i_which );
    FC_ASSERT( i_which >= 0, "Negative operation tag in operation ${op}", ("op",op) );
    FC_ASSERT( u_which < _operation_evaluators.size(), "No registered evaluator for operation ${op}", ("op",op) );
-   unique_ptr<op_evaluator>& eval = _operation_evaluators[ u_which ];
-   FC_ASSERT( eval, "No registered evaluator for operation ${op}", ("op",op) );
+   op_evaluator eval = _operation_evaluators[ u_which ];
+   FC_ASSERT( eval != nullptr, "No registered evaluator for operation ${op}", ("op",op) );
    auto op_id = push_applied_operation( op, is_virtual );
-   auto result = eval->evaluate( eval_state, op, true );
+   replay_profiler::operation_scope profile_scope( _replay_profiler.get(), u_which );
+   auto result = eval( eval_state, op, true );
    set_applied_operation_result( op_id, result );
    return result;
 } FC_CAPTURE_AND_RETHROW( (op) ) } // GCOVR_EXCL_LINE
@@ -870,47 +937,143 @@ bool database::before_last_checkpoint()const
 static const uint32_t skip_expensive = database::skip_transaction_signatures | database::skip_witness_signature
                                        | database::skip_merkle_check | database::skip_transaction_dupe_check;
 
+/// Only transactions in blocks have a merkle digest
+static void precompute_merkle_digest( const precomputable_transaction& trx )
+{
+   // nothing to do
+}
+
+static void precompute_merkle_digest( const processed_transaction& trx )
+{
+   trx.merkle_digest();
+}
+
+namespace {
+/// Operations of a range of transactions which are validated by their own workers
+struct split_validation
+{
+   struct deferred_operation
+   {
+      const precomputable_transaction* trx;
+      const operation*                 op;
+      std::atomic<uint32_t>*           pending;
+   };
+   /// For each transaction, 0 if it is validated as a whole, otherwise the number of its deferred operations plus 1
+   std::unique_ptr<std::atomic<uint32_t>[]> pending;
+   std::vector<deferred_operation>          ops;
+};
+}
+
+/// @return the operations of the transactions which are expensive to validate, or null if there are none
+template<typename Trx>
+static std::shared_ptr<split_validation> split_expensive_validations( const Trx* trx, const size_t count )
+{
+   std::shared_ptr<split_validation> split;
+   for( size_t i = 0; i < count; ++i )
+      for( const auto& op : trx[i].operations )
+      {
+         if( !operation_has_expensive_validation( op ) )
+            continue;
+         if( !split )
+         {
+            split = std::make_shared<split_validation>();
+            split->pending.reset( new std::atomic<uint32_t>[count]() );
+         }
+         if( 0 == split->pending[i] )
+            split->pending[i] = 1;
+         ++split->pending[i];
+         split->ops.push_back( { &trx[i], &op, &split->pending[i] } );
+      }
+   return split;
+}
+
+/// The last of the workers validating parts of a transaction marks it as validated
+static void release_validation( const precomputable_transaction& trx, std::atomic<uint32_t>& pending )
+{
+   if( 1 == pending.fetch_sub( 1 ) )
+      trx.set_validated();
+}
+
+static void launch_split_validations( const std::shared_ptr<split_validation>& split,
+                                      std::vector<fc::future<void>>& workers )
+{
+   const size_t chunks = fc::asio::default_io_service_scope::get_num_threads();
+   const size_t chunk_size = ( split->ops.size() + chunks - 1 ) / chunks;
+   for( size_t base = 0; base < split->ops.size(); base += chunk_size )
+      workers.push_back( fc::do_parallel( [split,base,chunk_size] () {
+         const size_t end = std::min( base + chunk_size, split->ops.size() );
+         for( size_t i = base; i < end; ++i )
+         {
+            operation_validate( *split->ops[i].op );
+            release_validation( *split->ops[i].trx, *split->ops[i].pending );
+         }
+      }) );
+}
+
 template<typename Trx>
-void database::_precompute_parallel( const Trx* trx, const size_t count, const uint32_t skip )const
+void database::_precompute_parallel( const Trx* trx, const size_t count, const uint32_t skip,
+                                     std::atomic<uint32_t>* pending )const
 {
    for( size_t i = 0; i < count; ++i, ++trx )
    {
-      trx->validate(); // TODO - parallelize wrt confidential operations
+      if( pending != nullptr && pending[i].load() != 0 )
+      {
+         trx->validate_except_expensive_operations();
+         release_validation( *trx, pending[i] );
+      }
+      else
+         trx->validate();
       if( 0 == (skip & skip_block_size_check) )
          trx->get_packed_size();
+      trx->get_operation_packed_size( 0 ); // caches the sizes of all operations for their data fees
       if( 0 == (skip&skip_transaction_dupe_check) )
          trx->id();
       if( 0 == (skip&skip_transaction_signatures) )
          trx->get_signature_keys( get_chain_id() );
+      if( 0 == (skip&skip_merkle_check) )
+         precompute_merkle_digest( *trx );
    }
 }
 
 fc::future<void> database::precompute_parallel( const signed_block& block, const uint32_t skip )const
 { try {
    std::vector<fc::future<void>> workers;
+   std::shared_ptr<split_validation> split;
    if( !block.transactions.empty() )
    {
       if( (skip & skip_expensive) == skip_expensive )
          _precompute_parallel( &block.transactions[0], block.transactions.size(), skip );
       else
       {
+         // confidential operations are validated by their own workers, so that a transaction with several of them
+         // or a block with many of them does not keep a single worker busy
+         split = split_expensive_validations( &block.transactions[0], block.transactions.size() );
+         std::atomic<uint32_t>* pending = split ? split->pending.get() : nullptr;
          uint32_t chunks = fc::asio::default_io_service_scope::get_num_threads();
          uint32_t chunk_size = ( block.transactions.size() + chunks - 1 ) / chunks;
-         workers.reserve( chunks + 1 );
+         workers.reserve( chunks * 2 + 1 );
          for( size_t base = 0; base < block.transactions.size(); base += chunk_size )
-            workers.push_back( fc::do_parallel( [this,&block,base,chunk_size,skip] () {
+            workers.push_back( fc::do_parallel( [this,&block,base,chunk_size,skip,split,pending] () {
                _precompute_parallel( &block.transactions[base],
                                      ( ( base + chunk_size ) < block.transactions.size() ) ? chunk_size
                                                  : ( block.transactions.size() - base ),
-                                     skip );
+                                     skip, pending ? pending + base : nullptr );
             }) );
       }
    }
 
+   const size_t trx_workers = workers.size();
+   if( split )
+      launch_split_validations( split, workers );
    if( 0 == (skip&skip_witness_signature) )
       workers.push_back( fc::do_parallel( [&block] () { block.signee(); } ) );
    if( 0 == (skip&skip_merkle_check) )
+   {
+      // the leaf digests are computed by the transaction workers, wait for them before building the tree
+      for( size_t i = 0; i < trx_workers; ++i )
+         workers[i].wait();
       block.calculate_merkle_root();
+   }
    block.id();
 
    if( workers.empty() )
@@ -925,9 +1088,24 @@ fc::future<void> database::precompute_parallel( const signed_block& block, const
 
 fc::future<void> database::precompute_parallel( const precomputable_transaction& trx )const
 {
-   return fc::do_parallel([this,&trx] () {
-      _precompute_parallel( &trx, 1, skip_nothing );
-   });
+   const auto split = split_expensive_validations( &trx, 1 );
+   if( !split )
+      return fc::do_parallel([this,&trx] () {
+         _precompute_parallel( &trx, 1, skip_nothing );
+      });
+
+   // validate the confidential operations of the transaction in parallel with each other and with the rest of it
+   std::vector<fc::future<void>> workers;
+   workers.push_back( fc::do_parallel([this,&trx,split] () {
+      _precompute_parallel( &trx, 1, skip_nothing, split->pending.get() );
+   }) );
+   launch_split_validations( split, workers );
+
+   auto first = workers.begin();
+   auto worker = first;
+   while( ++worker != workers.end() )
+      worker->wait();
+   return *first;
 }
 
 } }
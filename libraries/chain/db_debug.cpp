@@ -32,6 +32,9 @@
 #include <graphene/chain/witness_object.hpp>
 #include <graphene/chain/fba_object.hpp>
 
+#include <fc/interprocess/file_mapping.hpp>
+#include <fc/io/raw_variant.hpp>
+
 namespace graphene { namespace chain {
 
 /**
@@ -184,30 +187,130 @@ void debug_apply_update( database& db, const fc::variant_object& vo )
    }
 }
 
-void database::apply_debug_updates()
+void debug_apply_patch( database& db, const debug_object_patch& patch )
 {
-   block_id_type head_id = head_block_id();
-   auto it = _node_property_object.debug_updates.find( head_id );
-   if( it == _node_property_object.debug_updates.end() )
+   auto& idx = db.get_index( patch.id );
+   const object& obj = idx.get( patch.id );
+
+   switch( patch.action )
+   {
+      case debug_object_patch::write:
+         db.modify( obj, [&idx,&patch]( object& o )
+         {
+            idx.object_from_packed( patch.data, o );
+         } );
+         break;
+      case debug_object_patch::update:
+         db.modify( obj, [&idx,&patch]( object& o )
+         {
+            idx.object_fields_from_packed( patch.data, o );
+         } );
+         break;
+      case debug_object_patch::remove:
+         db.remove( obj );
+         break;
+      default:
+         FC_THROW( "Unknown debug patch action ${a}", ("a",patch.action) );
+   }
+}
+
+debug_patch_file::debug_patch_file( const fc::path& filename )
+{
+   FC_ASSERT( fc::exists( filename ), "File ${f} does not exist", ("f", filename) );
+   const auto file_size = fc::file_size( filename );
+   if( file_size > 0 )
+   {
+      _mapping = std::make_shared< fc::file_mapping >( filename.generic_string().c_str(), fc::read_only );
+      _region = std::make_shared< fc::mapped_region >( *_mapping, fc::read_only, 0, file_size );
+   }
+}
+
+void debug_patch_file::for_each_patch( const std::function< void( const debug_object_patch& ) >& apply )const
+{
+   if( !_region )
       return;
-   for( const fc::variant_object& update : it->second )
-      debug_apply_update( *this, update );
+
+   fc::datastream<const char*> ds( (const char*)_region->get_address(), _region->get_size() );
+   debug_object_patch patch;
+   while( ds.remaining() > 0 )
+   {
+      fc::raw::unpack( ds, patch );
+      apply( patch );
+   }
 }
 
-void database::debug_update( const fc::variant_object& update )
+void database::apply_debug_updates()
 {
-   block_id_type head_id = head_block_id();
-   auto it = _node_property_object.debug_updates.find( head_id );
+   auto it = _node_property_object.debug_updates.find( head_block_id() );
    if( it == _node_property_object.debug_updates.end() )
-      it = _node_property_object.debug_updates.emplace( head_id, std::vector< fc::variant_object >() ).first;
-   it->second.emplace_back( update );
+      return;
 
-   optional<signed_block> head_block = fetch_block_by_id( head_id );
+   for( const debug_update_type& update : it->second )
+   {
+      if( update.is_type< fc::variant_object >() )
+         debug_apply_update( *this, update.get< fc::variant_object >() );
+      else if( update.is_type< debug_object_patch >() )
+         debug_apply_patch( *this, update.get< debug_object_patch >() );
+      else
+         update.get< debug_patch_file >().for_each_patch( [this]( const debug_object_patch& patch ) {
+            debug_apply_patch( *this, patch );
+         } );
+   }
+}
+
+void database::debug_reapply_head_block()
+{
+   optional<signed_block> head_block = fetch_block_by_id( head_block_id() );
    FC_ASSERT( head_block.valid() );
 
-   // What the last block does has been changed by adding to node_property_object, so we have to re-apply it
+   // What the last block does has been changed by adding to node_property_object, so we have to re-apply it.
+   // All debug updates of the block are applied after the block in the same undo session, so popping the block
+   // reverts all of them at once.
    pop_block();
    push_block( *head_block );
 }
 
+void database::debug_update( const fc::variant_object& update )
+{
+   debug_update( std::vector< fc::variant_object >{ update } );
+}
+
+void database::debug_update( const std::vector< fc::variant_object >& updates )
+{
+   if( updates.empty() )
+      return;
+
+   auto& head_updates = _node_property_object.debug_updates[ head_block_id() ];
+   head_updates.reserve( head_updates.size() + updates.size() );
+   for( const fc::variant_object& update : updates )
+      head_updates.emplace_back( update );
+
+   debug_reapply_head_block();
+}
+
+void database::debug_apply_patches( std::vector< debug_object_patch > patches )
+{
+   if( patches.empty() )
+      return;
+
+   auto& head_updates = _node_property_object.debug_updates[ head_block_id() ];
+   head_updates.reserve( head_updates.size() + patches.size() );
+   for( debug_object_patch& patch : patches )
+      head_updates.emplace_back( std::move( patch ) );
+
+   debug_reapply_head_block();
+}
+
+void database::debug_apply_patch_file( const fc::path& filename )
+{
+   _node_property_object.debug_updates[ head_block_id() ].emplace_back( debug_patch_file( filename ) );
+   debug_reapply_head_block();
+}
+
+void database::debug_revert_updates()
+{
+   if( _node_property_object.debug_updates.erase( head_block_id() ) > 0 )
+      debug_reapply_head_block();
+}
+
 } }
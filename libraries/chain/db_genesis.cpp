@@ -40,6 +40,7 @@
 #include <graphene/chain/worker_object.hpp>
 
 #include <fc/crypto/digest.hpp>
+#include <fc/thread/parallel.hpp>
 
 #include <boost/algorithm/string.hpp>
 
@@ -291,31 +292,110 @@ void database::init_genesis(const genesis_state_type& genesis_state)
       } );
    }
 
-   // Create initial accounts
-   for( const auto& account : genesis_state.initial_accounts )
+   // Create initial accounts.
+   // The result is the same as applying an account_create_operation registered by the temp account for each of
+   // them, followed by an account_upgrade_operation for lifetime members, but the account objects are prepared
+   // in parallel and inserted without going through the evaluators.
    {
-      account_create_operation cop;
-      cop.name = account.name;
-      cop.registrar = GRAPHENE_TEMP_ACCOUNT;
-      cop.owner = authority(1, account.owner_key, 1);
-      if( account.active_key == public_key_type() )
+      const auto& params = get_global_properties().parameters;
+      FC_ASSERT( get( GRAPHENE_TEMP_ACCOUNT ).is_lifetime_member() );
+
+      // The operation left the referrer at its default, the committee account
+      account_object prototype;
+      prototype.registrar = GRAPHENE_TEMP_ACCOUNT;
+      prototype.referrer = GRAPHENE_COMMITTEE_ACCOUNT;
+      prototype.lifetime_referrer = get( GRAPHENE_COMMITTEE_ACCOUNT ).lifetime_referrer;
+      prototype.network_fee_percentage = params.network_percent_of_fee;
+      prototype.lifetime_referrer_fee_percentage = params.lifetime_referrer_percent_of_fee;
+      prototype.creation_block_num = _current_block_num;
+      prototype.creation_time = _current_block_time;
+
+      const auto prepare_account = []( const genesis_state_type::initial_account_type& account, account_object& a )
       {
-         cop.active = cop.owner;
-         cop.options.memo_key = account.owner_key;
-      }
-      else
+         a.name = account.name;
+         a.owner = authority(1, account.owner_key, 1);
+         if( account.active_key == public_key_type() )
+         {
+            a.active = a.owner;
+            a.options.memo_key = account.owner_key;
+         }
+         else
+         {
+            a.active = authority(1, account.active_key, 1);
+            a.options.memo_key = account.active_key;
+         }
+         a.num_committee_voted = a.options.num_committee_voted();
+         if( account.is_lifetime_member )
+         {
+            a.membership_expiration_date = time_point_sec::maximum();
+            a.lifetime_referrer_fee_percentage = GRAPHENE_100_PERCENT - a.network_fee_percentage;
+         }
+      };
+
+      const auto& accounts = genesis_state.initial_accounts;
+      const auto& accounts_by_name = get_index_type<account_index>().indices().get<by_name>();
+      uint32_t registered = get_dynamic_global_properties().accounts_registered_this_interval;
+      uint32_t fee_scale_steps = 0;
+
+      // Prepare and insert in batches to bound the memory used by prepared objects
+      const size_t threads = fc::asio::default_io_service_scope::get_num_threads();
+      const size_t batch_size = threads * 4096;
+      vector<account_object> prepared;
+      prepared.reserve( std::min( batch_size, accounts.size() ) );
+      for( size_t batch_begin = 0; batch_begin < accounts.size(); batch_begin += batch_size )
       {
-         cop.active = authority(1, account.active_key, 1);
-         cop.options.memo_key = account.active_key;
+         const size_t batch_end = std::min( batch_begin + batch_size, accounts.size() );
+         prepared.assign( batch_end - batch_begin, prototype );
+
+         const size_t chunk_size = ( prepared.size() + threads - 1 ) / threads;
+         std::vector<fc::future<void>> workers;
+         workers.reserve( threads );
+         for( size_t base = 0; base < prepared.size(); base += chunk_size )
+            workers.push_back( fc::do_parallel( [&accounts,&prepared,&prepare_account,batch_begin,base,chunk_size] () {
+               const size_t end = std::min( base + chunk_size, prepared.size() );
+               for( size_t i = base; i < end; ++i )
+                  prepare_account( accounts[ batch_begin + i ], prepared[i] );
+            }) );
+         for( auto& worker : workers )
+            worker.wait();
+
+         for( size_t i = 0; i < prepared.size(); ++i )
+         {
+            const bool is_lifetime_member = accounts[ batch_begin + i ].is_lifetime_member;
+            account_object& source = prepared[i];
+            FC_ASSERT( accounts_by_name.find( source.name ) == accounts_by_name.end(),
+                       "Account '${a}' already exists.", ("a",source.name) );
+            create<account_object>( [this,&source,is_lifetime_member]( account_object& obj )
+            {
+               const object_id_type new_id = obj.id;
+               obj = std::move( source );
+               obj.id = new_id;
+               if( is_lifetime_member )
+                  obj.referrer = obj.registrar = obj.lifetime_referrer = obj.get_id();
+               obj.statistics = create<account_statistics_object>([&obj](account_statistics_object& s){
+                                   s.owner = obj.id;
+                                   s.name = obj.name;
+                                   s.is_voting = obj.options.is_voting();
+                                }).id;
+            });
+
+            ++registered;
+            if( params.account_fee_scale_bitshifts != 0 && params.accounts_per_fee_scale != 0
+                  && registered % params.accounts_per_fee_scale == 0 )
+               ++fee_scale_steps;
+         }
       }
-      account_id_type account_id(apply_operation(genesis_eval_state, cop).get<object_id_type>());
 
-      if( account.is_lifetime_member )
+      modify( get_dynamic_global_properties(), [registered]( dynamic_global_property_object& p ) {
+         p.accounts_registered_this_interval = registered;
+      });
+      if( fee_scale_steps > 0 )
       {
-          account_upgrade_operation op;
-          op.account_to_upgrade = account_id;
-          op.upgrade_to_lifetime_member = true;
-          apply_operation(genesis_eval_state, op);
+         modify( get_global_properties(), [fee_scale_steps]( global_property_object& p ) {
+            for( uint32_t i = 0; i < fee_scale_steps; ++i )
+               p.parameters.get_mutable_fees().get<account_create_operation>().basic_fee
+                     <<= p.parameters.account_fee_scale_bitshifts;
+         });
       }
    }
 
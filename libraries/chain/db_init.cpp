@@ -160,7 +160,8 @@ void database::initialize_indexes()
    add_index< primary_index<asset_index, 13> >(); // 8192 assets per chunk
    add_index< primary_index<force_settlement_index> >();
 
-   add_index< primary_index<account_index, 20> >(); // ~1 million accounts per chunk
+   auto acnt_idx = add_index< primary_index<account_index, 20> >(); // ~1 million accounts per chunk
+   acnt_idx->add_secondary_index<account_authority_cache_invalidator>( &_authority_cache );
    add_index< primary_index<committee_member_index, 8> >(); // 256 members per chunk
    add_index< primary_index<witness_index, 10> >(); // 1024 witnesses per chunk
    add_index< primary_index<limit_order_index > >();
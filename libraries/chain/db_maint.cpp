@@ -100,19 +100,27 @@ void database::perform_account_maintenance(Type tally_helper)
    const auto& stats_idx = get_index_type< account_stats_index >().indices().get< by_maintenance_seq >();
    auto stats_itr = stats_idx.lower_bound( true );
 
+   // Referral fees are collected and deposited once per recipient
+   fee_payout_accumulator payouts( *this );
+
    while( stats_itr != stats_idx.end() )
    {
       const account_statistics_object& acc_stat = *stats_itr;
       const account_object& acc_obj = acc_stat.owner( *this );
       ++stats_itr;
 
+      // The tally may count the cashback balance of the account
+      payouts.apply( acc_obj.get_id() );
+
       if( acc_stat.has_some_core_voting() )
          tally_helper( acc_obj, acc_stat );
 
       if( acc_stat.has_pending_fees() )
-         acc_stat.process_fees( acc_obj, *this );
+         acc_stat.process_fees( acc_obj, *this, &payouts );
    }
 
+   payouts.apply_all();
+
 }
 
 /// @brief A visitor for @ref worker_type which calls pay_worker on the worker within
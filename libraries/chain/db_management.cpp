@@ -28,6 +28,7 @@
 #include <graphene/chain/witness_schedule_object.hpp>
 #include <graphene/chain/special_authority_object.hpp>
 #include <graphene/chain/operation_history_object.hpp>
+#include <graphene/chain/replay_profiler.hpp>
 
 #include <graphene/protocol/fee_schedule.hpp>
 
@@ -68,6 +69,8 @@ void database::reindex( fc::path data_dir )
    uint32_t undo_point = last_block_num < GRAPHENE_MAX_UNDO_HISTORY ? 0 : (last_block_num - GRAPHENE_MAX_UNDO_HISTORY);
 
    ilog( "Replaying blocks, starting at ${next}...", ("next",head_block_num() + 1) );
+   if( _operation_log.is_open() )
+      _operation_log.truncate( head_block_num() + 1 );
    if( head_block_num() >= undo_point )
    {
       if( head_block_num() > 0 )
@@ -153,15 +156,57 @@ void database::reindex( fc::path data_dir )
             _undo_db.enable();
             push_block( block, skip );
          }
+         if( _replay_profiler )
+            _replay_profiler->block_replayed( block, _undo_db );
          blocks.pop();
          ++i;
       }
    }
    _undo_db.enable();
+   if( _replay_profiler )
+      _replay_profiler->finish( _undo_db );
    auto end = fc::time_point::now();
    ilog( "Done reindexing, elapsed time: ${t} sec", ("t",double((end-start).count())/1000000.0 ) );
 } FC_CAPTURE_AND_RETHROW( (data_dir) ) }
 
+void database::replay_operation_log( const std::function<void(const signed_block&)>& processor )
+{ try {
+   FC_ASSERT( _operation_log.is_open(), "The operation log is not enabled" );
+   const uint32_t head_num = head_block_num();
+   const uint32_t missing = _operation_log.first_missing_block_num( head_num );
+   FC_ASSERT( missing > head_num,
+              "The operation log is incomplete, block ${n} is missing, please reindex to rebuild it",
+              ("n", missing) );
+
+   ilog( "Replaying operation log of ${n} blocks", ("n", head_num) );
+   auto start = fc::time_point::now();
+   _undo_db.disable();
+   try
+   {
+      for( uint32_t block_num = 1; block_num <= head_num; ++block_num )
+      {
+         if( block_num % 100000 == 0 )
+            ilog( "   ${i} of ${n}", ("i", block_num)("n", head_num) );
+         optional<signed_block> block = _block_id_to_block.fetch_by_number( block_num );
+         FC_ASSERT( block.valid(), "Block ${n} is missing", ("n", block_num) );
+         optional<operation_log::applied_operations> ops = _operation_log.fetch( block_num );
+         FC_ASSERT( ops.valid(), "Operations of block ${n} are missing", ("n", block_num) );
+         _applied_ops = std::move( *ops );
+         processor( *block );
+         _applied_ops.clear();
+      }
+   }
+   catch( ... )
+   {
+      _applied_ops.clear();
+      _undo_db.enable();
+      throw;
+   }
+   _undo_db.enable();
+   auto end = fc::time_point::now();
+   ilog( "Done replaying operation log, elapsed time: ${t} sec", ("t",double((end-start).count())/1000000.0 ) );
+} FC_CAPTURE_AND_RETHROW() }
+
 void database::wipe(const fc::path& data_dir, bool include_blocks)
 {
    ilog("Wiping database", ("include_blocks", include_blocks));
@@ -201,6 +246,8 @@ void database::open(
       object_database::open(data_dir);
 
       _block_id_to_block.open(data_dir / "database" / "block_num_to_block");
+      if( _operation_log_enabled )
+         _operation_log.open(data_dir / "database" / "block_num_to_operations");
 
       if( !find(global_property_id_type()) )
          init_genesis(genesis_loader());
@@ -270,6 +317,9 @@ void database::close(bool rewinding)
    if( _block_id_to_block.is_open() )
       _block_id_to_block.close();
 
+   if( _operation_log.is_open() )
+      _operation_log.close();
+
    _fork_db.reset();
 
    _opened = false;
@@ -114,6 +114,8 @@ database& generic_evaluator::db()const { return trx_state->db(); }
 
    share_type generic_evaluator::calculate_fee_for_operation(const operation& op) const
    {
+     if( trx_state->current_op_packed_size.valid() )
+        return db().current_fee_schedule().calculate_fee( op, *trx_state->current_op_packed_size ).amount;
      return db().current_fee_schedule().calculate_fee( op ).amount;
    }
    void generic_evaluator::db_adjust_balance(const account_id_type& fee_payer, asset fee_from_account)
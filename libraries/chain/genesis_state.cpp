@@ -23,10 +23,13 @@
  */
 
 #include <graphene/chain/genesis_state.hpp>
+#include <graphene/chain/json_stream_reader.hpp>
 #include <graphene/protocol/fee_schedule.hpp>
 
 #include <fc/io/raw.hpp>
 
+#include <fstream>
+
 namespace graphene { namespace chain {
 
 chain_id_type genesis_state_type::compute_chain_id() const
@@ -76,6 +79,70 @@ FC_REFLECT_DERIVED_NO_TYPENAME(graphene::chain::genesis_state_type, BOOST_PP_SEQ
            (initial_committee_candidates)(initial_worker_candidates)
            (immutable_parameters))
 
+namespace graphene { namespace chain {
+
+namespace {
+
+/// Reads the value of the genesis member named @c key, converting array members element by element
+struct genesis_member_reader
+{
+   json_stream_reader& reader;
+   genesis_state_type& genesis;
+   const std::string&  key;
+   uint32_t            max_depth;
+   bool&               found;
+
+   template<typename Member, class Class, Member (Class::*member)>
+   void operator()( const char* name )const
+   {
+      if( found || key != name )
+         return;
+      found = true;
+      read_member( genesis.*member );
+   }
+
+   template<typename T>
+   void read_member( vector<T>& values )const
+   {
+      values.clear();
+      reader.read_array( [this,&values]() {
+         values.emplace_back( reader.read_value().as<T>( max_depth - 2 ) );
+      });
+   }
+
+   template<typename T>
+   void read_member( T& value )const
+   {
+      fc::from_variant( reader.read_value(), value, max_depth - 1 );
+   }
+};
+
+} // anonymous namespace
+
+genesis_state_type read_genesis_state( std::istream& in, uint32_t max_depth )
+{ try {
+   FC_ASSERT( max_depth > 2, "The maximum depth is too small for a genesis state" );
+   genesis_state_type genesis;
+   json_stream_reader reader( in, max_depth );
+   reader.read_object( [&reader,&genesis,max_depth]( const std::string& key ) {
+      bool found = false;
+      fc::reflector<genesis_state_type>::visit( genesis_member_reader{ reader, genesis, key, max_depth, found } );
+      if( !found )
+         reader.skip_value();
+   });
+   reader.expect_end();
+   return genesis;
+} FC_CAPTURE_AND_RETHROW( (max_depth) ) } // GCOVR_EXCL_LINE
+
+genesis_state_type read_genesis_state_from_file( const fc::path& file, uint32_t max_depth )
+{ try {
+   std::ifstream in( file.generic_string().c_str(), std::ios::in | std::ios::binary );
+   FC_ASSERT( in.good(), "Unable to open ${f}", ("f", file) );
+   return read_genesis_state( in, max_depth );
+} FC_CAPTURE_AND_RETHROW( (file)(max_depth) ) } // GCOVR_EXCL_LINE
+
+} } // graphene::chain
+
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::genesis_state_type::initial_account_type )
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::genesis_state_type::initial_asset_type )
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::chain::genesis_state_type::initial_asset_type::initial_collateral_position )
@@ -26,14 +26,56 @@
 #include <graphene/chain/types.hpp>
 #include <graphene/db/generic_index.hpp>
 #include <graphene/protocol/account.hpp>
+#include <graphene/protocol/transaction.hpp>
 
 #include <boost/multi_index/composite_key.hpp>
 
+#include <map>
+
 namespace graphene { namespace chain {
    class database;
    class account_object;
    class vesting_balance_object;
 
+   /**
+    * @brief Collects the payouts of @ref account_statistics_object::process_fees during a maintenance interval
+    *
+    * Network fees are added to the core asset once, and cashback to an existing vesting balance is deposited once
+    * per recipient, instead of once per fee payer. Deposits which create a vesting balance are applied right away,
+    * so that objects are created in the same order as without collecting.
+    */
+   class fee_payout_accumulator
+   {
+      public:
+         explicit fee_payout_accumulator( database& db ) : _db( db ) {}
+
+         void add_network_fee( share_type amount ) { _network_fees += amount; }
+         /// Same result as @ref database::deposit_cashback once collected payouts are applied
+         void add_cashback( const account_object& recipient, share_type amount, bool require_vesting );
+
+         /// Applies the collected cashback of @p account, must be called before its cashback balance is read
+         void apply( account_id_type account );
+         /// Applies all collected payouts
+         void apply_all();
+
+         /// Number of payouts which have been merged into a collected payout, i.e. modifications saved
+         uint64_t merged_payouts()const { return _merged_payouts; }
+
+      private:
+         struct pending_cashback
+         {
+            vesting_balance_id_type vesting_balance;
+            share_type              vesting;
+            share_type              vested;
+         };
+
+         database&                                   _db;
+         share_type                                  _network_fees;
+         share_type                                  _reserve_cashback;
+         std::map<account_id_type, pending_cashback> _cashback;
+         uint64_t                                    _merged_payouts = 0;
+   };
+
    /**
     * @class account_statistics_object
     * @ingroup object
@@ -138,8 +180,11 @@ namespace graphene { namespace chain {
          /// Whether need to process this account during the maintenance interval
          inline bool need_maintenance() const { return has_some_core_voting() || has_pending_fees(); }
 
-         /// @brief Split up and pay out @ref pending_fees and @ref pending_vested_fees
-         void process_fees(const account_object& a, database& d) const;
+         /**
+          * @brief Split up and pay out @ref pending_fees and @ref pending_vested_fees
+          * @param payouts if not null, collects the payouts to other objects instead of applying them
+          */
+         void process_fees(const account_object& a, database& d, fee_payout_accumulator* payouts = nullptr) const;
 
          /**
           * Core fees are paid into the account_statistics_object by this method
@@ -323,6 +368,23 @@ namespace graphene { namespace chain {
          }
    };
 
+   /**
+    *  @brief This secondary index clears an authority_satisfaction_cache whenever an account is created,
+    *  removed or modified, including when changes are undone.
+    */
+   class account_authority_cache_invalidator : public secondary_index
+   {
+      public:
+         explicit account_authority_cache_invalidator( authority_satisfaction_cache* cache ) : _cache( cache ) {}
+
+         void object_inserted( const object& obj ) override { _cache->clear(); }
+         void object_removed( const object& obj ) override { _cache->clear(); }
+         void object_modified( const object& after ) override { _cache->clear(); }
+
+      private:
+         authority_satisfaction_cache* _cache;
+   };
+
    /**
     *  @brief This secondary index will allow a reverse lookup of all accounts that a particular key or account
     *  is an potential signing authority.
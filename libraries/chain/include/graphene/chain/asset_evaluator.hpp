@@ -195,4 +195,8 @@ namespace graphene { namespace chain {
          void_result do_apply( const asset_claim_pool_operation& o );
    };
 
+   // Frequent operations, instantiated with their evaluators, see evaluate_operation
+   extern template operation_result evaluate_operation<asset_publish_feeds_evaluator>( transaction_evaluation_state&,
+                                                                                       const operation&, bool );
+
 } } // graphene::chain
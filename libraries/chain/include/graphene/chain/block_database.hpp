@@ -27,6 +27,8 @@
 
 #include <fc/filesystem.hpp>
 
+#include <memory>
+
 namespace graphene { namespace chain {
    struct index_entry;
    using namespace graphene::protocol;
@@ -46,6 +48,8 @@ namespace graphene { namespace chain {
          block_id_type          fetch_block_id( uint32_t block_num )const;
          optional<signed_block> fetch_optional( const block_id_type& id )const;
          optional<signed_block> fetch_by_number( uint32_t block_num )const;
+         /// View of a stored block, to access its header or some of its transactions without unpacking all of it
+         optional<signed_block_view> fetch_view( uint32_t block_num )const;
          optional<signed_block> last()const;
          optional<block_id_type> last_id()const;
          size_t                 blocks_current_position()const;
@@ -56,4 +60,26 @@ namespace graphene { namespace chain {
          mutable std::fstream _blocks;
          mutable std::fstream _block_num_to_pos;
    };
+
+   /**
+    * @brief Read-only, memory-mapped access to the files of a @ref block_database
+    *
+    * Unlike @ref block_database, which reads through shared streams, any number of threads can fetch blocks
+    * concurrently. Blocks stored after the files were mapped are not visible.
+    */
+   class mapped_block_database
+   {
+      public:
+         explicit mapped_block_database( const fc::path& dbdir );
+         ~mapped_block_database();
+
+         /// Highest block number covered by the index, 0 if it is empty. Slots of missing blocks may be empty.
+         uint32_t                  last_block_num()const;
+         /// View of a stored block, empty if the block is missing or damaged
+         optional<signed_block_view> fetch_view( uint32_t block_num )const;
+      private:
+         struct mapped_file;
+         std::unique_ptr<mapped_file> _index;
+         std::unique_ptr<mapped_file> _blocks;
+   };
 } }
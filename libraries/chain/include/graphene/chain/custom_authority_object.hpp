@@ -64,7 +64,7 @@ namespace graphene { namespace chain {
          return rs;
       }
       /// Get predicate, from cache if possible, and update cache if not (modifies const object!)
-      restriction_predicate_function get_predicate() const {
+      const restriction_predicate_function& get_predicate() const {
          if (!predicate_cache.valid())
             update_predicate_cache();
 
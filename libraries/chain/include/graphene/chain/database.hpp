@@ -31,6 +31,7 @@
 #include <graphene/chain/asset_object.hpp>
 #include <graphene/chain/fork_database.hpp>
 #include <graphene/chain/block_database.hpp>
+#include <graphene/chain/operation_log.hpp>
 #include <graphene/chain/genesis_state.hpp>
 #include <graphene/chain/evaluator.hpp>
 
@@ -41,6 +42,7 @@
 
 #include <fc/log/logger.hpp>
 
+#include <atomic>
 #include <map>
 
 namespace graphene { namespace protocol { struct predicate_result; } }
@@ -48,7 +50,6 @@ namespace graphene { namespace protocol { struct predicate_result; } }
 namespace graphene { namespace chain {
    using graphene::db::abstract_object;
    using graphene::db::object;
-   class op_evaluator;
    class transaction_evaluation_state;
    class proposal_object;
    class operation_history_object;
@@ -59,6 +60,7 @@ namespace graphene { namespace chain {
    class limit_order_object;
    class collateral_bid_object;
    class call_order_object;
+   class replay_profiler;
 
    struct budget_record;
    enum class vesting_balance_type;
@@ -125,6 +127,35 @@ namespace graphene { namespace chain {
          void wipe(const fc::path& data_dir, bool include_blocks);
          void close(bool rewind = true);
 
+         /**
+          * @brief Store the operations applied in each block in an @ref operation_log next to the block log
+          *
+          * Must be called before @ref database::open. Blocks applied while the log is disabled are not stored.
+          */
+         void enable_operation_log( bool enable ) { _operation_log_enabled = enable; }
+         bool is_operation_log_enabled()const { return _operation_log_enabled; }
+
+         /**
+          * @brief Feed the stored operation log of blocks 1 to head through a block processor
+          * @param processor called once per block, while @ref get_applied_operations returns the stored
+          *                  operations of the block
+          *
+          * This rebuilds the state of plugins which only depend on blocks and applied operations without
+          * re-applying the blocks. The operation log must be enabled and complete up to the head block.
+          * Undo is disabled during the replay, so objects created by the processor for blocks which are
+          * still reversible can not be removed by popping these blocks.
+          */
+         void replay_operation_log( const std::function<void(const signed_block&)>& processor );
+
+         /**
+          * @brief Record a time series of where the time goes while @ref reindex replays blocks
+          *
+          * Must be set before @ref database::open to profile the replay on open. Reset it to a null pointer
+          * afterwards, since operations of pushed blocks and transactions are timed as long as it is set.
+          */
+         void set_replay_profiler( std::shared_ptr<replay_profiler> profiler )
+         { _replay_profiler = std::move( profiler ); }
+
          //////////////////// db_witness_schedule.cpp ////////////////////
 
          /**
@@ -239,7 +270,7 @@ namespace graphene { namespace chain {
             FC_ASSERT( op_type < _operation_evaluators.size(),
                        "The operation type (${a}) must be smaller than the size of _operation_evaluators (${b})",
                        ("a", op_type)("b", _operation_evaluators.size()) );
-            _operation_evaluators[op_type] = std::make_unique<op_evaluator_impl<EvaluatorType>>();
+            _operation_evaluators[op_type] = &evaluate_operation<EvaluatorType>;
          }
          ///@}
 
@@ -295,6 +326,8 @@ namespace graphene { namespace chain {
 
          /// helper to handle cashback rewards
          void deposit_cashback(const account_object& acct, share_type amount, bool require_vesting = true);
+         /// whether the account is one of the blockchain's accounts, whose cashback goes to the reserve pool
+         static bool is_cashback_reserved_account( account_id_type acct_id );
          /// helper to handle witness pay
          void deposit_witness_pay(const witness_object& wit, share_type amount);
 
@@ -305,6 +338,18 @@ namespace graphene { namespace chain {
          void debug_dump();
          void apply_debug_updates();
          void debug_update( const fc::variant_object& update );
+         /// Apply a batch of updates with a single re-application of the head block
+         void debug_update( const std::vector< fc::variant_object >& updates );
+         /// Apply a batch of binary patches with a single re-application of the head block,
+         /// note: updates and patches of a block are applied in the order they were given
+         void debug_apply_patches( std::vector< debug_object_patch > patches );
+         /// Apply the patches of a file while reading it, with a single re-application of the head block
+         void debug_apply_patch_file( const fc::path& filename );
+         /// Revert all debug updates and patches applied on top of the head block
+         void debug_revert_updates();
+      private:
+         void debug_reapply_head_block();
+      public:
 
          //////////////////// db_market.cpp ////////////////////
 
@@ -563,7 +608,14 @@ namespace graphene { namespace chain {
          bool                       is_known_transaction( const transaction_id_type& id )const;
          block_id_type              get_block_id_for_num( uint32_t block_num )const;
          optional<signed_block>     fetch_block_by_id( const block_id_type& id )const;
+         /// Same as @ref fetch_block_by_id, but the block stays packed until it is accessed through the view
+         optional<signed_block_view> fetch_block_view_by_id( const block_id_type& id )const;
          optional<signed_block>     fetch_block_by_number( uint32_t num )const;
+         /// Same as the header of @ref fetch_block_by_number, without unpacking the transactions of the block
+         optional<signed_block_header>  fetch_block_header_by_number( uint32_t num )const;
+         /// Same as a transaction of @ref fetch_block_by_number, without unpacking the transactions after it
+         optional<processed_transaction> fetch_transaction_by_number( uint32_t block_num,
+                                                                      uint32_t trx_in_block )const;
          const signed_transaction&  get_recent_transaction( const transaction_id_type& trx_id )const;
          std::vector<block_id_type> get_block_ids_on_fork(block_id_type head_of_fork) const;
 
@@ -683,8 +735,11 @@ namespace graphene { namespace chain {
           */
          fc::future<void> precompute_parallel( const precomputable_transaction& trx )const;
       private:
+         /// @param pending if not null, the validation counters of the transactions whose expensive operations are
+         ///                validated by other workers, see @ref precomputable_transaction::set_validated
          template<typename Trx>
-         void _precompute_parallel( const Trx* trx, const size_t count, const uint32_t skip )const;
+         void _precompute_parallel( const Trx* trx, const size_t count, const uint32_t skip,
+                                    std::atomic<uint32_t>* pending = nullptr )const;
 
       protected:
          // Mark pop_undo() as protected -- we do not want outside calling pop_undo(),
@@ -693,7 +748,7 @@ namespace graphene { namespace chain {
 
       private:
          optional<undo_database::session>       _pending_tx_session;
-         vector< unique_ptr<op_evaluator> >     _operation_evaluators;
+         vector< op_evaluator >                 _operation_evaluators;
 
          template<class Index>
          vector<std::reference_wrapper<const typename Index::object_type>> sort_votable_objects(size_t count)const;
@@ -708,6 +763,9 @@ namespace graphene { namespace chain {
       private:
          void                  _apply_block( const signed_block& next_block );
          processed_transaction _apply_transaction( const signed_transaction& trx );
+         /// Same as above, but only the operation results are stored, into @p results, without copying @p trx
+         void                  _apply_transaction( const signed_transaction& trx,
+                                                   vector<operation_result>& results );
 
          /// Validate, evaluate and apply a virtual operation using a temporary undo_database session,
          /// if fail, rewind any changes made
@@ -787,6 +845,16 @@ namespace graphene { namespace chain {
           */
          block_database   _block_id_to_block;
 
+         /// Operations applied in each block, only maintained if @ref enable_operation_log is called
+         operation_log    _operation_log;
+         bool             _operation_log_enabled = false;
+
+         /// Profiler of block replays, only set if @ref set_replay_profiler is called
+         std::shared_ptr<replay_profiler> _replay_profiler;
+
+         /// Results of authority checks, cleared for each block and when any account changes
+         authority_satisfaction_cache _authority_cache;
+
          /**
           * Contains the set of ops that are in the process of being applied from
           * the current block.  It contains real and virtual operations in the
@@ -120,23 +120,12 @@ namespace graphene { namespace chain {
       transaction_evaluation_state*    trx_state;
    };
 
-   class op_evaluator
-   {
-   public:
-      virtual ~op_evaluator(){}
-      virtual operation_result evaluate(transaction_evaluation_state& eval_state, const operation& op, bool apply) = 0;
-   };
-
-   template<typename T>
-   class op_evaluator_impl : public op_evaluator
-   {
-   public:
-      virtual operation_result evaluate(transaction_evaluation_state& eval_state, const operation& op, bool apply = true) override
-      {
-         T eval;
-         return eval.start_evaluate(eval_state, op, apply);
-      }
-   };
+   /**
+    * Evaluates an operation, and applies it if requested, with an evaluator which is selected by the operation type.
+    * The database keeps one such function per operation type, see @ref evaluate_operation.
+    */
+   using op_evaluator = operation_result (*)( transaction_evaluation_state& eval_state, const operation& op,
+                                              bool apply );
 
    template<typename DerivedEvaluator>
    class evaluator : public generic_evaluator
@@ -144,6 +133,20 @@ namespace graphene { namespace chain {
    public:
       virtual int get_type()const override { return operation::tag<typename DerivedEvaluator::operation_type>::value; }
 
+      /**
+       * Same as @ref start_evaluate, but the evaluation and application of the operation are bound statically,
+       * so that they can be inlined into @ref evaluate_operation
+       */
+      operation_result start_evaluate_static( transaction_evaluation_state& eval_state, const operation& o,
+                                              bool apply_op )
+      { try {
+         trx_state = &eval_state;
+         auto result = evaluator::evaluate( o );
+
+         if( apply_op ) result = evaluator::apply( o );
+         return result;
+      } FC_CAPTURE_AND_RETHROW() }
+
       virtual operation_result evaluate(const operation& o) final override
       {
          auto* eval = static_cast<DerivedEvaluator*>(this);
@@ -152,7 +155,7 @@ namespace graphene { namespace chain {
          prepare_fee(op.fee_payer(), op.fee);
          if( !trx_state->skip_fee_schedule_check )
          {
-            share_type required_fee = calculate_fee_for_operation(op);
+            share_type required_fee = calculate_fee_for_operation(o);
             GRAPHENE_ASSERT( core_fee_paid >= required_fee,
                        insufficient_fee,
                        "Insufficient Fee Paid",
@@ -177,4 +180,18 @@ namespace graphene { namespace chain {
          return result;
       }
    };
+
+   /**
+    * @brief Evaluate an operation with an evaluator of type @p T constructed on the stack
+    *
+    * The evaluators of frequent operations explicitly instantiate this function in the translation units which
+    * define their @c do_evaluate and @c do_apply, and declare the instantiation extern in their headers, so that
+    * the whole evaluation of such an operation is compiled into one function.
+    */
+   template<typename T>
+   operation_result evaluate_operation( transaction_evaluation_state& eval_state, const operation& op, bool apply )
+   {
+      T eval;
+      return eval.start_evaluate_static( eval_state, op, apply );
+   }
 } }
@@ -29,7 +29,9 @@
 #include <graphene/chain/immutable_chain_parameters.hpp>
 
 #include <fc/crypto/sha256.hpp>
+#include <fc/filesystem.hpp>
 
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -130,6 +132,15 @@ struct genesis_state_type {
 
 };
 
+/**
+ * Read a genesis state from JSON. The elements of its arrays are converted one at a time while the input is
+ * parsed, so that a large genesis file is never held as a whole variant tree in memory.
+ * @param max_depth maximum nesting depth of the JSON document
+ */
+genesis_state_type read_genesis_state( std::istream& in, uint32_t max_depth );
+/// Read a genesis state from a JSON file, see @ref read_genesis_state
+genesis_state_type read_genesis_state_from_file( const fc::path& file, uint32_t max_depth );
+
 } } // namespace graphene::chain
 
 FC_REFLECT_TYPENAME( graphene::chain::genesis_state_type::initial_account_type )
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <fc/variant.hpp>
+
+#include <functional>
+#include <istream>
+#include <string>
+
+namespace graphene { namespace chain {
+
+   /**
+    * @brief Reads a JSON document from a stream one value at a time.
+    *
+    * Objects and arrays can be iterated member by member and element by element, so that a large document can be
+    * converted into typed structs while only one element at a time is held as a @c fc::variant. Values which are
+    * not iterated are parsed by @c fc::json as a whole.
+    */
+   class json_stream_reader
+   {
+      public:
+         json_stream_reader( std::istream& in, uint32_t max_depth );
+
+         /// Iterates the members of the object at the current position, @p handler must consume each value
+         void read_object( const std::function<void( const std::string& key )>& handler );
+         /// Iterates the elements of the array at the current position, @p handler must consume each element
+         void read_array( const std::function<void()>& handler );
+         /// Parses the value at the current position
+         fc::variant read_value();
+         /// Skips the value at the current position
+         void skip_value();
+         /// Asserts that nothing but whitespace is left in the stream
+         void expect_end();
+
+      private:
+         int  peek_non_space();
+         void expect( char c );
+         /// Copies the raw text of the value at the current position to @p out, or skips it if @p out is null
+         void capture_value( std::string* out );
+         void capture_string( std::string* out );
+
+         std::streambuf& _in;
+         uint32_t        _max_depth;
+         uint32_t        _depth = 0;
+         std::string     _buffer;
+   };
+
+} }
@@ -131,4 +131,10 @@ namespace graphene { namespace chain {
          const collateral_bid_object* _bid = nullptr;
    };
 
+   // Frequent operations, instantiated with their evaluators, see evaluate_operation
+   extern template operation_result evaluate_operation<limit_order_create_evaluator>( transaction_evaluation_state&,
+                                                                                      const operation&, bool );
+   extern template operation_result evaluate_operation<limit_order_cancel_evaluator>( transaction_evaluation_state&,
+                                                                                      const operation&, bool );
+
 } } // graphene::chain
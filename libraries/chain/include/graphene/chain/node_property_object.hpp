@@ -24,8 +24,59 @@
 #pragma once
 #include <graphene/db/object.hpp>
 
+#include <fc/filesystem.hpp>
+#include <fc/static_variant.hpp>
+#include <fc/variant_object.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace fc { class file_mapping; class mapped_region; }
+
 namespace graphene { namespace chain {
 
+   /**
+    * @brief A binary patch of one object, used by the debug_witness plugin to change the state in bulk.
+    *
+    * A patch file is a sequence of packed patches.
+    */
+   struct debug_object_patch
+   {
+      enum action_type : uint8_t
+      {
+         write  = 0, ///< object must exist, is replaced entirely by the packed object in @ref data
+         update = 1, ///< object must exist, @ref data holds the fields to change, see index::object_fields_to_packed
+         remove = 2  ///< object must exist, will be deleted, @ref data is empty
+      };
+
+      uint8_t             action = write;
+      object_id_type      id;
+      std::vector<char>   data;
+   };
+
+   /**
+    * @brief A file of packed patches, mapped into memory and applied while it is read.
+    *
+    * The file must not change while the patches are applied on top of the head block.
+    */
+   class debug_patch_file
+   {
+      public:
+         debug_patch_file() = default;
+         explicit debug_patch_file( const fc::path& filename );
+
+         /// Unpack the patches one at a time and call @p apply on each, in the order of the file
+         void for_each_patch( const std::function< void( const debug_object_patch& ) >& apply )const;
+
+      private:
+         std::shared_ptr< fc::file_mapping >   _mapping;
+         std::shared_ptr< fc::mapped_region >  _region;
+   };
+
+   /// A debug update of the state, either in the JSON format of database::debug_update, a binary patch or a
+   /// file of binary patches
+   using debug_update_type = fc::static_variant< fc::variant_object, debug_object_patch, debug_patch_file >;
+
    /**
     * @brief Contains per-node database configuration.
     *
@@ -43,6 +94,9 @@ namespace graphene { namespace chain {
          ~node_property_object(){}
 
          uint32_t skip_flags = 0;
-         std::map< block_id_type, std::vector< fc::variant_object > > debug_updates;
+         /// Debug updates of a block, applied after the block in the order they were given
+         std::map< block_id_type, std::vector< debug_update_type > > debug_updates;
    };
 } } // graphene::chain
+
+FC_REFLECT( graphene::chain::debug_object_patch, (action)(id)(data) )
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <graphene/chain/operation_history_object.hpp>
+
+#include <fc/filesystem.hpp>
+
+#include <fstream>
+
+namespace graphene { namespace chain {
+
+   /**
+    * @brief Stores the operations applied in each block, including virtual operations and operation results.
+    *
+    * This is a sidecar of @ref block_database. With it, the state of plugins which only depend on blocks and
+    * applied operations can be rebuilt without re-applying the blocks, see @ref database::replay_operation_log.
+    */
+   class operation_log
+   {
+      public:
+         using applied_operations = vector< optional< operation_history_object > >;
+
+         void open( const fc::path& dbdir );
+         bool is_open()const;
+         void flush();
+         void close();
+
+         /// Store the operations applied in a block, removes operations previously stored for this and later blocks
+         void store( uint32_t block_num, const applied_operations& ops );
+         /// Remove the operations stored for @p block_num and all later blocks
+         void truncate( uint32_t block_num );
+         /// Fetch the operations applied in a block, returns an empty optional if not found
+         optional< applied_operations > fetch( uint32_t block_num )const;
+         /// Returns the number of the first block which is not stored after a continuous range starting at 1
+         uint32_t first_missing_block_num( uint32_t max_block_num )const;
+
+      private:
+         fc::path             _index_filename;
+         fc::path             _ops_filename;
+         mutable std::fstream _ops;
+         mutable std::fstream _block_num_to_pos;
+   };
+
+} }
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <graphene/protocol/block.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/time.hpp>
+
+#include <fstream>
+
+namespace graphene { namespace db { class undo_database; } }
+
+namespace graphene { namespace chain {
+
+   /**
+    * @brief Records where the time goes while blocks are replayed, as a time series of block ranges.
+    *
+    * Every @c interval blocks one record is written with the throughput of the range, the time spent per
+    * operation type, in chain maintenance and in observers of applied blocks and changed objects (i.e. plugins),
+    * and the size of the undo history at the end of the range.
+    *
+    * Records are written as JSON lines, or as CSV rows if the file name ends with ".csv". The file is flushed
+    * after each record, so an interrupted replay still leaves usable results.
+    *
+    * Only top-level operations are timed; virtual operations applied while evaluating another operation are
+    * included in the time of that operation.
+    */
+   class replay_profiler
+   {
+      public:
+         replay_profiler( const fc::path& output_file, uint32_t interval );
+
+         /// Times an operation if it is not nested in another timed operation, does nothing if @c profiler is null
+         class operation_scope
+         {
+            public:
+               operation_scope( replay_profiler* profiler, uint64_t which );
+               ~operation_scope();
+
+            private:
+               replay_profiler* _profiler;
+               uint64_t         _which;
+               fc::time_point   _start;
+         };
+
+         void add_maintenance_time( const fc::microseconds& elapsed );
+         void add_observer_time( const fc::microseconds& elapsed );
+
+         /// Called after each replayed block, writes a record when the block ends a range
+         void block_replayed( const signed_block& block, const graphene::db::undo_database& undo_db );
+         /// Writes the record of an incomplete last range, if any
+         void finish( const graphene::db::undo_database& undo_db );
+
+      private:
+         struct operation_stats
+         {
+            uint64_t        count = 0;
+            fc::microseconds time;
+         };
+
+         void write_record( const graphene::db::undo_database& undo_db );
+         void reset_range();
+
+         std::ofstream                 _out;
+         bool                          _csv = false;
+         uint32_t                      _interval;
+
+         uint32_t                      _operation_depth = 0;
+
+         uint32_t                      _first_block = 0;
+         uint32_t                      _last_block = 0;
+         fc::time_point                _range_start;
+         uint64_t                      _blocks = 0;
+         uint64_t                      _transactions = 0;
+         uint64_t                      _operations = 0;
+         uint64_t                      _maintenances = 0;
+         fc::microseconds              _maintenance_time;
+         fc::microseconds              _observer_time;
+         std::vector<operation_stats>  _operation_stats;
+   };
+
+} }
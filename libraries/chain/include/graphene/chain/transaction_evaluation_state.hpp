@@ -49,5 +49,7 @@ namespace chain {
          bool                             _is_proposed_trx = false;
          bool                             skip_fee_schedule_check = false;
          bool                             skip_limit_order_price_check = false; // Used in limit_order_update_op
+         /// Packed size of the operation being evaluated if it is known, to calculate its data fees without packing it
+         optional<uint64_t>               current_op_packed_size;
    };
 } } // namespace graphene::chain
@@ -46,4 +46,8 @@ namespace graphene { namespace chain {
          void_result do_apply( const override_transfer_operation& o );
    };
 
+   // Frequent operations, instantiated with their evaluators, see evaluate_operation
+   extern template operation_result evaluate_operation<transfer_evaluator>( transaction_evaluation_state&,
+                                                                            const operation&, bool );
+
 } } // graphene::chain
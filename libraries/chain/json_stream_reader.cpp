@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <graphene/chain/json_stream_reader.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/io/json.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace graphene { namespace chain {
+
+json_stream_reader::json_stream_reader( std::istream& in, uint32_t max_depth )
+: _in( *in.rdbuf() ), _max_depth( max_depth )
+{
+   FC_ASSERT( in.good(), "Unable to read JSON input" );
+}
+
+int json_stream_reader::peek_non_space()
+{
+   int c = _in.sgetc();
+   while( c != std::char_traits<char>::eof() && std::isspace( c ) )
+      c = _in.snextc();
+   return c;
+}
+
+void json_stream_reader::expect( char c )
+{
+   const int next = peek_non_space();
+   FC_ASSERT( next == c, "Expected '${e}' in JSON input, found '${f}'",
+              ("e", std::string( 1, c ))
+              ("f", next == std::char_traits<char>::eof() ? std::string( "end of input" ) : std::string( 1, char(next) )) );
+   _in.sbumpc();
+}
+
+void json_stream_reader::capture_string( std::string* out )
+{
+   // Assumes the opening quote has been checked, but not consumed
+   if( out != nullptr )
+      out->push_back( char( _in.sbumpc() ) );
+   else
+      _in.sbumpc();
+   while( true )
+   {
+      const int c = _in.sbumpc();
+      FC_ASSERT( c != std::char_traits<char>::eof(), "Unterminated string in JSON input" );
+      if( out != nullptr )
+         out->push_back( char(c) );
+      if( c == '"' )
+         return;
+      if( c == '\\' )
+      {
+         const int escaped = _in.sbumpc();
+         FC_ASSERT( escaped != std::char_traits<char>::eof(), "Unterminated string in JSON input" );
+         if( out != nullptr )
+            out->push_back( char(escaped) );
+      }
+   }
+}
+
+void json_stream_reader::capture_value( std::string* out )
+{
+   const int first = peek_non_space();
+   FC_ASSERT( first != std::char_traits<char>::eof(), "Unexpected end of JSON input" );
+   if( first == '"' )
+   {
+      capture_string( out );
+      return;
+   }
+   if( first == '{' || first == '[' )
+   {
+      uint32_t nesting = 0;
+      while( true )
+      {
+         const int c = _in.sgetc();
+         FC_ASSERT( c != std::char_traits<char>::eof(), "Unexpected end of JSON input" );
+         if( c == '"' )
+         {
+            capture_string( out );
+            continue;
+         }
+         _in.sbumpc();
+         if( out != nullptr )
+            out->push_back( char(c) );
+         if( c == '{' || c == '[' )
+         {
+            ++nesting;
+            FC_ASSERT( _depth + nesting <= _max_depth, "JSON input is nested too deeply" );
+         }
+         else if( c == '}' || c == ']' )
+         {
+            if( 0 == --nesting )
+               return;
+         }
+      }
+   }
+   // A number or a literal, which ends at a delimiter
+   int c = first;
+   while( c != std::char_traits<char>::eof() && c != ',' && c != '}' && c != ']' && !std::isspace( c ) )
+   {
+      if( out != nullptr )
+         out->push_back( char(c) );
+      c = _in.snextc();
+   }
+}
+
+fc::variant json_stream_reader::read_value()
+{
+   _buffer.clear();
+   capture_value( &_buffer );
+   return fc::json::from_string( _buffer, fc::json::legacy_parser, std::max<uint32_t>( 1, _max_depth - _depth ) );
+}
+
+void json_stream_reader::skip_value()
+{
+   capture_value( nullptr );
+}
+
+void json_stream_reader::read_object( const std::function<void( const std::string& key )>& handler )
+{
+   expect( '{' );
+   ++_depth;
+   FC_ASSERT( _depth <= _max_depth, "JSON input is nested too deeply" );
+   if( peek_non_space() == '}' )
+      _in.sbumpc();
+   else
+   {
+      while( true )
+      {
+         FC_ASSERT( peek_non_space() == '"', "Expected a member name in JSON input" );
+         _buffer.clear();
+         capture_string( &_buffer );
+         const std::string key = fc::json::from_string( _buffer ).as_string();
+         expect( ':' );
+         handler( key );
+         const int c = peek_non_space();
+         _in.sbumpc();
+         if( c == '}' )
+            break;
+         FC_ASSERT( c == ',', "Expected ',' or '}' after a member in JSON input" );
+      }
+   }
+   --_depth;
+}
+
+void json_stream_reader::read_array( const std::function<void()>& handler )
+{
+   expect( '[' );
+   ++_depth;
+   FC_ASSERT( _depth <= _max_depth, "JSON input is nested too deeply" );
+   if( peek_non_space() == ']' )
+      _in.sbumpc();
+   else
+   {
+      while( true )
+      {
+         handler();
+         const int c = peek_non_space();
+         _in.sbumpc();
+         if( c == ']' )
+            break;
+         FC_ASSERT( c == ',', "Expected ',' or ']' after an element in JSON input" );
+      }
+   }
+   --_depth;
+}
+
+void json_stream_reader::expect_end()
+{
+   FC_ASSERT( peek_non_space() == std::char_traits<char>::eof(), "Unexpected data after the end of JSON input" );
+}
+
+} } // graphene::chain
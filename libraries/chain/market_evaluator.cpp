@@ -880,4 +880,9 @@ void_result bid_collateral_evaluator::do_apply(const bid_collateral_operation& o
    return void_result();
 } FC_CAPTURE_AND_RETHROW( (o) ) } // GCOVR_EXCL_LINE
 
+template operation_result evaluate_operation<limit_order_create_evaluator>( transaction_evaluation_state&,
+                                                                            const operation&, bool );
+template operation_result evaluate_operation<limit_order_cancel_evaluator>( transaction_evaluation_state&,
+                                                                            const operation&, bool );
+
 } } // graphene::chain
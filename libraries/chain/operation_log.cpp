@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <graphene/chain/operation_log.hpp>
+
+#include <fc/io/raw.hpp>
+
+#include <algorithm>
+
+#include <boost/endian/buffers.hpp>
+
+namespace graphene { namespace chain {
+
+struct operation_log_index_entry
+{
+   boost::endian::little_uint64_buf_t ops_pos;
+   boost::endian::little_uint32_buf_t ops_size; ///< 0 means not stored, since an empty vector packs to 1 byte
+};
+
+void operation_log::open( const fc::path& dbdir )
+{ try {
+   fc::create_directories(dbdir);
+   _block_num_to_pos.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+   _ops.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+
+   _index_filename = dbdir / "index";
+   _ops_filename = dbdir / "operations";
+   auto mode = std::fstream::binary | std::fstream::in | std::fstream::out;
+   if( !fc::exists( _index_filename ) || !fc::exists( _ops_filename ) )
+      mode |= std::fstream::trunc;
+   _block_num_to_pos.open( _index_filename.generic_string().c_str(), mode );
+   _ops.open( _ops_filename.generic_string().c_str(), mode );
+} FC_CAPTURE_AND_RETHROW( (dbdir) ) }
+
+bool operation_log::is_open()const
+{
+   return _ops.is_open();
+}
+
+void operation_log::close()
+{
+   _ops.close();
+   _block_num_to_pos.close();
+}
+
+void operation_log::flush()
+{
+   _ops.flush();
+   _block_num_to_pos.flush();
+}
+
+void operation_log::store( uint32_t block_num, const applied_operations& ops )
+{
+   // the block is applied again, e.g. after a fork switch, so anything stored from it on is outdated
+   truncate( block_num );
+
+   const auto vec = fc::raw::pack( ops );
+   operation_log_index_entry e;
+   _ops.seekp( 0, _ops.end );
+   e.ops_pos  = _ops.tellp();
+   e.ops_size = vec.size();
+   _ops.write( vec.data(), vec.size() );
+
+   const int64_t index_pos = sizeof(e) * int64_t(block_num);
+   _block_num_to_pos.seekp( 0, _block_num_to_pos.end );
+   const int64_t index_size = _block_num_to_pos.tellp();
+   if( index_size < index_pos )
+   {
+      // fill the gap with empty entries
+      const std::vector<char> zeros( index_pos - index_size, 0 );
+      _block_num_to_pos.write( zeros.data(), zeros.size() );
+   }
+   _block_num_to_pos.seekp( index_pos );
+   _block_num_to_pos.write( (char*)&e, sizeof(e) );
+}
+
+void operation_log::truncate( uint32_t block_num )
+{ try {
+   operation_log_index_entry e;
+   const int64_t index_pos = sizeof(e) * int64_t(block_num);
+   _block_num_to_pos.seekg( 0, _block_num_to_pos.end );
+   const int64_t index_size = _block_num_to_pos.tellg();
+   if( index_size <= index_pos )
+      return;
+
+   // operations are stored in the order of their blocks, so they end where the first removed block starts
+   optional<uint64_t> ops_end;
+   _block_num_to_pos.seekg( index_pos );
+   for( int64_t pos = index_pos; !ops_end.valid() && pos + int64_t(sizeof(e)) <= index_size; pos += sizeof(e) )
+   {
+      _block_num_to_pos.read( (char*)&e, sizeof(e) );
+      if( e.ops_size.value() > 0 )
+         ops_end = e.ops_pos.value();
+   }
+
+   flush();
+   if( ops_end.valid() )
+      fc::resize_file( _ops_filename, *ops_end );
+   fc::resize_file( _index_filename, index_pos );
+} FC_CAPTURE_AND_RETHROW( (block_num) ) }
+
+optional< operation_log::applied_operations > operation_log::fetch( uint32_t block_num )const
+{
+   try
+   {
+      operation_log_index_entry e;
+      const int64_t index_pos = sizeof(e) * int64_t(block_num);
+      _block_num_to_pos.seekg( 0, _block_num_to_pos.end );
+      if ( _block_num_to_pos.tellg() < int64_t(index_pos + sizeof(e)) )
+         return {};
+
+      _block_num_to_pos.seekg( index_pos );
+      _block_num_to_pos.read( (char*)&e, sizeof(e) );
+      if( e.ops_size.value() == 0 )
+         return {};
+
+      vector<char> data( e.ops_size.value() );
+      _ops.seekg( e.ops_pos.value() );
+      _ops.read( data.data(), e.ops_size.value() );
+      return fc::raw::unpack< applied_operations >( data );
+   }
+   catch (const fc::exception&)
+   {
+   }
+   catch (const std::exception&)
+   {
+   }
+   return {};
+}
+
+uint32_t operation_log::first_missing_block_num( uint32_t max_block_num )const
+{
+   operation_log_index_entry e;
+   _block_num_to_pos.seekg( 0, _block_num_to_pos.end );
+   const int64_t index_size = _block_num_to_pos.tellg();
+   const int64_t stored_count = index_size / int64_t(sizeof(e)) - 1; // entry 0 is not used
+   const uint32_t last_to_check = std::min<int64_t>( max_block_num, std::max<int64_t>( stored_count, 0 ) );
+
+   // read sequentially
+   _block_num_to_pos.seekg( sizeof(e) );
+   for( uint32_t block_num = 1; block_num <= last_to_check; ++block_num )
+   {
+      _block_num_to_pos.read( (char*)&e, sizeof(e) );
+      if( e.ops_size.value() == 0 )
+         return block_num;
+   }
+   return last_to_check + 1;
+}
+
+} }
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <graphene/chain/replay_profiler.hpp>
+
+#include <graphene/db/undo_database.hpp>
+
+#include <fc/io/json.hpp>
+#include <fc/variant_object.hpp>
+
+#include <iomanip>
+
+namespace graphene { namespace chain {
+
+namespace {
+
+double to_seconds( const fc::microseconds& t )
+{
+   return double( t.count() ) / 1000000.0;
+}
+
+} // anonymous namespace
+
+replay_profiler::replay_profiler( const fc::path& output_file, uint32_t interval )
+: _interval( interval )
+{
+   FC_ASSERT( interval > 0, "The profiling interval must be positive" );
+   if( !output_file.parent_path().generic_string().empty() )
+      fc::create_directories( output_file.parent_path() );
+   _out.open( output_file.generic_string().c_str(), std::ios::out | std::ios::trunc );
+   FC_ASSERT( _out.good(), "Unable to open ${f}", ("f", output_file) );
+   _csv = ( output_file.extension().generic_string() == ".csv" );
+   if( _csv )
+      _out << "first_block,last_block,category,name,count,seconds\n";
+
+   _operation_stats.resize( operation::count() );
+}
+
+replay_profiler::operation_scope::operation_scope( replay_profiler* profiler, uint64_t which )
+: _profiler( profiler ), _which( which )
+{
+   if( _profiler != nullptr && 0 == _profiler->_operation_depth++ )
+      _start = fc::time_point::now();
+}
+
+replay_profiler::operation_scope::~operation_scope()
+{
+   if( _profiler != nullptr && 0 == --_profiler->_operation_depth && _which < _profiler->_operation_stats.size() )
+   {
+      auto& stats = _profiler->_operation_stats[ _which ];
+      ++stats.count;
+      stats.time += fc::time_point::now() - _start;
+   }
+}
+
+void replay_profiler::add_maintenance_time( const fc::microseconds& elapsed )
+{
+   ++_maintenances;
+   _maintenance_time += elapsed;
+}
+
+void replay_profiler::add_observer_time( const fc::microseconds& elapsed )
+{
+   _observer_time += elapsed;
+}
+
+void replay_profiler::block_replayed( const signed_block& block, const graphene::db::undo_database& undo_db )
+{
+   const uint32_t block_num = block.block_num();
+   if( 0 == _blocks )
+   {
+      _first_block = block_num;
+      if( _range_start == fc::time_point() )
+         _range_start = fc::time_point::now();
+   }
+   _last_block = block_num;
+   ++_blocks;
+   _transactions += block.transactions.size();
+   for( const auto& trx : block.transactions )
+      _operations += trx.operations.size();
+
+   if( 0 == block_num % _interval )
+      write_record( undo_db );
+}
+
+void replay_profiler::finish( const graphene::db::undo_database& undo_db )
+{
+   if( _blocks > 0 )
+      write_record( undo_db );
+   _out.flush();
+}
+
+void replay_profiler::write_record( const graphene::db::undo_database& undo_db )
+{
+   const auto now = fc::time_point::now();
+   const double seconds = to_seconds( now - _range_start );
+   const uint64_t undo_states = undo_db.size();
+   const uint64_t undo_objects = undo_db.stored_object_count();
+
+   if( _csv )
+   {
+      const auto row = [this]( const char* category, const std::string& name, uint64_t count, double secs )
+      {
+         _out << _first_block << ',' << _last_block << ',' << category << ',' << name << ',' << count << ','
+              << std::fixed << std::setprecision(6) << secs << '\n';
+      };
+      row( "range", "blocks", _blocks, seconds );
+      row( "range", "transactions", _transactions, seconds );
+      row( "range", "operations", _operations, seconds );
+      row( "maintenance", "", _maintenances, to_seconds( _maintenance_time ) );
+      row( "observers", "", _blocks, to_seconds( _observer_time ) );
+      row( "undo", "states", undo_states, 0 );
+      row( "undo", "objects", undo_objects, 0 );
+      for( size_t i = 0; i < _operation_stats.size(); ++i )
+      {
+         if( _operation_stats[i].count > 0 )
+            row( "operation", operation_name( i ), _operation_stats[i].count, to_seconds( _operation_stats[i].time ) );
+      }
+   }
+   else
+   {
+      fc::mutable_variant_object operations;
+      for( size_t i = 0; i < _operation_stats.size(); ++i )
+      {
+         if( _operation_stats[i].count > 0 )
+            operations( operation_name( i ), fc::mutable_variant_object()
+                                                ( "count", _operation_stats[i].count )
+                                                ( "seconds", to_seconds( _operation_stats[i].time ) ) );
+      }
+      fc::mutable_variant_object record;
+      record( "first_block", _first_block )
+            ( "last_block", _last_block )
+            ( "seconds", seconds )
+            ( "blocks", _blocks )
+            ( "transactions", _transactions )
+            ( "operations", _operations )
+            ( "blocks_per_second", seconds > 0 ? double( _blocks ) / seconds : 0.0 )
+            ( "operations_per_second", seconds > 0 ? double( _operations ) / seconds : 0.0 )
+            ( "maintenances", _maintenances )
+            ( "maintenance_seconds", to_seconds( _maintenance_time ) )
+            ( "observer_seconds", to_seconds( _observer_time ) )
+            ( "undo_states", undo_states )
+            ( "undo_objects", undo_objects )
+            ( "operation_types", operations );
+      _out << fc::json::to_string( fc::variant( record ) ) << '\n';
+   }
+   _out.flush();
+
+   reset_range();
+   _range_start = now;
+}
+
+void replay_profiler::reset_range()
+{
+   _blocks = 0;
+   _transactions = 0;
+   _operations = 0;
+   _maintenances = 0;
+   _maintenance_time = fc::microseconds();
+   _observer_time = fc::microseconds();
+   for( auto& stats : _operation_stats )
+      stats = operation_stats();
+}
+
+} } // graphene::chain
@@ -123,4 +123,7 @@ void_result override_transfer_evaluator::do_apply( const override_transfer_opera
    return void_result();
 } FC_CAPTURE_AND_RETHROW( (o) ) }
 
+template operation_result evaluate_operation<transfer_evaluator>( transaction_evaluation_state&,
+                                                                  const operation&, bool );
+
 } } // graphene::chain
@@ -28,7 +28,9 @@
 #include <fc/io/raw.hpp>
 #include <fc/io/json.hpp>
 #include <fc/crypto/sha256.hpp>
+#include <fc/variant_object.hpp>
 
+#include <cstring>
 #include <fstream>
 #include <stack>
 
@@ -133,6 +135,17 @@ namespace graphene { namespace db {
          virtual void add_observer( const std::shared_ptr<index_observer>& ) = 0;
 
          virtual void object_from_variant( const fc::variant& var, object& obj, uint32_t max_depth )const = 0;
+         /// Replace the content of obj with a packed object of the same type, the ID of obj is kept
+         virtual void object_from_packed( const std::vector<char>& data, object& obj )const = 0;
+         /**
+          * Pack the fields of this index's object type named in @p fields, as the number of fields followed by
+          * the position among the reflected members and the packed value of each field, in the order of the members.
+          * Unknown names and the ID are ignored.
+          */
+         virtual std::vector<char> object_fields_to_packed( const fc::variant_object& fields,
+                                                            uint32_t max_depth )const = 0;
+         /// Change the fields of obj packed by @ref object_fields_to_packed, the other fields and the ID are kept
+         virtual void object_fields_from_packed( const std::vector<char>& data, object& obj )const = 0;
          virtual void object_default( object& obj )const = 0;
    };
 
@@ -308,6 +321,78 @@ namespace graphene { namespace db {
     *
     *  @see http://en.wikipedia.org/wiki/Curiously_recurring_template_pattern
     */
+   namespace detail {
+
+   template< typename T >
+   struct packed_fields_from_variant_visitor
+   {
+      packed_fields_from_variant_visitor( const fc::variant_object& f, uint32_t _max_depth )
+      : fields(f), max_depth(_max_depth) {}
+
+      template<typename Member, class Class, Member (Class::*member)>
+      void operator()( const char* name )const
+      {
+         auto it = fields.find( name );
+         if( it != fields.end() && std::strcmp( name, "id" ) != 0 )
+         {
+            Member temp;
+            fc::from_variant( it->value(), temp, max_depth );
+            packed.emplace_back( which, fc::raw::pack( temp ) );
+         }
+         ++which;
+      }
+
+      const fc::variant_object& fields;
+      const uint32_t max_depth;
+      mutable uint32_t which = 0;
+      mutable std::vector< std::pair< uint32_t, std::vector<char> > > packed;
+   };
+
+   template< typename Stream, typename T >
+   struct packed_fields_unpack_visitor
+   {
+      packed_fields_unpack_visitor( Stream& s, T& v ) : stream(s), value(v)
+      {
+         fc::unsigned_int c;
+         fc::raw::unpack( stream, c );
+         count_left = c.value;
+         maybe_read_next_which();
+      }
+
+      void maybe_read_next_which()const
+      {
+         if( count_left > 0 )
+         {
+            fc::unsigned_int w;
+            fc::raw::unpack( stream, w );
+            next_which = w.value;
+         }
+      }
+
+      template<typename Member, class Class, Member (Class::*member)>
+      void operator()( const char* name )const
+      {
+         if( (count_left > 0) && (which == next_which) )
+         {
+            Member temp;
+            fc::raw::unpack( stream, temp );
+            (value.*member) = std::move( temp );
+            --count_left;
+            maybe_read_next_which();
+         }
+         ++which;
+      }
+
+      mutable uint32_t which = 0;
+      mutable uint32_t next_which = 0;
+      mutable uint32_t count_left = 0;
+
+      Stream& stream;
+      T& value;
+   };
+
+   } // namespace detail
+
    template<typename DerivedIndex, uint8_t DirectBits = 0>
    class primary_index  : public DerivedIndex, public base_primary_index
    {
@@ -440,6 +525,47 @@ namespace graphene { namespace db {
             obj.id = id;
          }
 
+         void object_from_packed( const std::vector<char>& data, object& obj )const override
+         {
+            object_id_type id = obj.id;
+            object_type* result = dynamic_cast<object_type*>( &obj );
+            FC_ASSERT( result != nullptr );
+            fc::raw::unpack( data, *result );
+            obj.id = id;
+         }
+
+         std::vector<char> object_fields_to_packed( const fc::variant_object& fields,
+                                                    uint32_t max_depth )const override
+         {
+            detail::packed_fields_from_variant_visitor<object_type> vtor( fields, max_depth );
+            fc::reflector<object_type>::visit( vtor );
+
+            size_t size = fc::raw::pack_size( fc::unsigned_int( vtor.packed.size() ) );
+            for( const auto& field : vtor.packed )
+               size += fc::raw::pack_size( fc::unsigned_int( field.first ) ) + field.second.size();
+            std::vector<char> data( size );
+            fc::datastream<char*> ds( data.data(), data.size() );
+            fc::raw::pack( ds, fc::unsigned_int( vtor.packed.size() ) );
+            for( const auto& field : vtor.packed )
+            {
+               fc::raw::pack( ds, fc::unsigned_int( field.first ) );
+               ds.write( field.second.data(), field.second.size() );
+            }
+            return data;
+         }
+
+         void object_fields_from_packed( const std::vector<char>& data, object& obj )const override
+         {
+            object_id_type id = obj.id;
+            object_type* result = dynamic_cast<object_type*>( &obj );
+            FC_ASSERT( result != nullptr );
+            fc::datastream<const char*> ds( data.data(), data.size() );
+            detail::packed_fields_unpack_visitor< fc::datastream<const char*>, object_type > vtor( ds, *result );
+            fc::reflector<object_type>::visit( vtor );
+            FC_ASSERT( vtor.count_left == 0 && ds.remaining() == 0, "Unknown or unsorted fields in packed fields" );
+            obj.id = id;
+         }
+
          void object_default( object& obj )const override
          {
             object_id_type id = obj.id;
@@ -121,6 +121,8 @@ namespace graphene { namespace db {
          void set_max_size(size_t new_max_size) { _max_size = new_max_size; }
          size_t max_size()const { return _max_size; }
          uint32_t active_sessions()const { return _active_sessions; }
+         /// Returns the number of object copies and new object IDs held by all undo states
+         std::size_t stored_object_count()const;
 
          const undo_state& head()const;
 
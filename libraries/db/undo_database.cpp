@@ -304,4 +304,12 @@ const undo_state& undo_database::head()const
    return _stack.back();
 }
 
+std::size_t undo_database::stored_object_count()const
+{
+   std::size_t count = 0;
+   for( const auto& state : _stack )
+      count += state.old_values.size() + state.removed.size() + state.new_ids.size();
+   return count;
+}
+
 } } // graphene::db
@@ -47,6 +47,19 @@ namespace graphene { namespace net {
   const core_message_type_enum get_current_connections_request_message::type = core_message_type_enum::get_current_connections_request_message_type;
   const core_message_type_enum get_current_connections_reply_message::type   = core_message_type_enum::get_current_connections_reply_message_type;
 
+  void trx_message::unpack_from_wire( const std::shared_ptr<const std::vector<char>>& buffer,
+                                      fc::datastream<const char*>& ds )
+  {
+    trx.unpack_from_wire( buffer, ds );
+  }
+
+  void block_message::unpack_from_wire( const std::shared_ptr<const std::vector<char>>& buffer,
+                                        fc::datastream<const char*>& ds )
+  {
+    block.unpack_from_wire( buffer, ds );
+    fc::raw::unpack( ds, block_id );
+  }
+
 } } // graphene::net
 
 FC_REFLECT_DERIVED_NO_TYPENAME( graphene::net::trx_message, BOOST_PP_SEQ_NIL, (trx) )
@@ -99,6 +99,10 @@ namespace graphene { namespace net {
       explicit trx_message(const graphene::protocol::signed_transaction& signed_trx) :
         trx(signed_trx)
       {}
+
+      /// Unpack the message and keep the transaction ID and packed size computed from the wire bytes
+      void unpack_from_wire( const std::shared_ptr<const std::vector<char>>& buffer,
+                             fc::datastream<const char*>& ds );
    };
 
    struct block_message
@@ -112,6 +116,9 @@ namespace graphene { namespace net {
       signed_block    block;
       block_id_type   block_id;
 
+      /// Unpack the message and keep the digests of the transactions computed from the wire bytes
+      void unpack_from_wire( const std::shared_ptr<const std::vector<char>>& buffer,
+                             fc::datastream<const char*>& ds );
    };
 
   struct item_ids_inventory_message
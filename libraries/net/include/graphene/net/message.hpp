@@ -30,6 +30,8 @@
 #include <fc/network/ip.hpp>
 #include <fc/crypto/ripemd160.hpp>
 
+#include <memory>
+
 namespace graphene { namespace net {
 
   /**
@@ -112,6 +114,28 @@ namespace graphene { namespace net {
               ("msg_type", msg_type.value())
               );
      }
+
+     /**
+      *  Same as as(), but lets T keep a shared copy of the wire bytes, for types which
+      *  provide unpack_from_wire(), e.g. to avoid repacking the transactions of a block.
+      */
+     template<typename T>
+     T as_from_wire()const
+     {
+         try {
+          FC_ASSERT( msg_type.value() == T::type );
+          T tmp;
+          auto buffer = std::make_shared<const std::vector<char>>( data );
+          fc::datastream<const char*> ds( buffer->data(), buffer->size() );
+          tmp.unpack_from_wire( buffer, ds );
+          return tmp;
+         } FC_RETHROW_EXCEPTIONS( warn,
+              "error unpacking network message as a '${type}'  ${x} !=? ${msg_type}",
+              ("type", fc::get_typename<T>::name() )
+              ("x", T::type)
+              ("msg_type", msg_type.value())
+              );
+     }
   };
 
 } } // graphene::net
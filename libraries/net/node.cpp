@@ -3470,7 +3470,8 @@ namespace graphene { namespace net { namespace detail {
       // (it's possible that we request an item during normal operation and then get kicked into sync
       // mode before we receive and process the item.  In that case, we should process the item as a normal
       // item to avoid confusing the sync code)
-      graphene::net::block_message block_message_to_process(message_to_process.as<graphene::net::block_message>());
+      graphene::net::block_message block_message_to_process(
+                message_to_process.as_from_wire<graphene::net::block_message>());
       auto item_iter = originating_peer->items_requested_from_peer.find(
                              item_id(graphene::net::block_message_type, message_hash));
       if (item_iter != originating_peer->items_requested_from_peer.end())
@@ -3605,7 +3606,7 @@ namespace graphene { namespace net { namespace detail {
         {
           if (message_to_process.msg_type.value() == trx_message_type)
           {
-            trx_message transaction_message_to_process = message_to_process.as<trx_message>();
+            trx_message transaction_message_to_process = message_to_process.as_from_wire<trx_message>();
             dlog( "passing message containing transaction ${trx} to client",
                   ("trx", transaction_message_to_process.trx.id()) );
             _delegate->handle_transaction(transaction_message_to_process);
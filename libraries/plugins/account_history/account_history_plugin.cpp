@@ -158,7 +158,7 @@ void account_history_plugin_impl::update_account_histories( const signed_block&
       vector<authority> other;
       // fee payer is added here
       operation_get_required_authorities( op.op, impacted, impacted, other,
-                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( db.head_block_time() ) );
+                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( b.timestamp ) );
 
       if( op.op.is_type< account_create_operation >() )
          impacted.insert( account_id_type( op.result.get<object_id_type>() ) );
@@ -167,7 +167,7 @@ void account_history_plugin_impl::update_account_histories( const signed_block&
       if( HARDFORK_CORE_265_PASSED(b.timestamp) || !op.op.is_type< account_create_operation >() )
       {
          operation_get_impacted_accounts( op.op, impacted,
-                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( db.head_block_time() ) );
+                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( b.timestamp ) );
       }
 
       if( op.result.is_type<extendable_operation_result>() )
@@ -490,6 +490,11 @@ void account_history_plugin::plugin_startup()
 {
 }
 
+void account_history_plugin::plugin_replay_block( const signed_block& b )
+{
+   my->update_account_histories( b );
+}
+
 flat_set<account_id_type> account_history_plugin::tracked_accounts() const
 {
    return my->_tracked_accounts;
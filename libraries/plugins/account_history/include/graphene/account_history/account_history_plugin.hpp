@@ -96,6 +96,7 @@ class account_history_plugin : public graphene::app::plugin
          boost::program_options::options_description& cfg) override;
       void plugin_initialize(const boost::program_options::variables_map& options) override;
       void plugin_startup() override;
+      void plugin_replay_block( const signed_block& b ) override;
 
       flat_set<account_id_type> tracked_accounts()const;
 
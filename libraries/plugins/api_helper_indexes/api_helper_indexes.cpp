@@ -35,21 +35,23 @@ void amount_in_collateral_index::object_inserted( const object& objct )
    const call_order_object& o = static_cast<const call_order_object&>( objct );
 
    {
-      auto itr = in_collateral.find( o.collateral_type() );
-      if( itr == in_collateral.end() )
-         in_collateral[o.collateral_type()] = o.collateral;
+      auto itr = _data.in_collateral.find( o.collateral_type() );
+      if( itr == _data.in_collateral.end() )
+         _data.in_collateral[o.collateral_type()] = o.collateral;
       else
          itr->second += o.collateral;
    }
 
    {
-      auto itr = backing_collateral.find( o.debt_type() );
-      if( itr == backing_collateral.end() )
-         backing_collateral[o.debt_type()] = o.collateral;
+      auto itr = _data.backing_collateral.find( o.debt_type() );
+      if( itr == _data.backing_collateral.end() )
+         _data.backing_collateral[o.debt_type()] = o.collateral;
       else
          itr->second += o.collateral;
    }
 
+   _dirty = true;
+
 } FC_CAPTURE_AND_RETHROW( (objct) ) } // GCOVR_EXCL_LINE
 
 void amount_in_collateral_index::object_removed( const object& objct )
@@ -57,17 +59,19 @@ void amount_in_collateral_index::object_removed( const object& objct )
    const call_order_object& o = static_cast<const call_order_object&>( objct );
 
    {
-      auto itr = in_collateral.find( o.collateral_type() );
-      if( itr != in_collateral.end() ) // should always be true
+      auto itr = _data.in_collateral.find( o.collateral_type() );
+      if( itr != _data.in_collateral.end() ) // should always be true
          itr->second -= o.collateral;
    }
 
    {
-      auto itr = backing_collateral.find( o.debt_type() );
-      if( itr != backing_collateral.end() ) // should always be true
+      auto itr = _data.backing_collateral.find( o.debt_type() );
+      if( itr != _data.backing_collateral.end() ) // should always be true
          itr->second -= o.collateral;
    }
 
+   _dirty = true;
+
 } FC_CAPTURE_AND_RETHROW( (objct) ) } // GCOVR_EXCL_LINE
 
 void amount_in_collateral_index::about_to_modify( const object& objct )
@@ -80,35 +84,71 @@ void amount_in_collateral_index::object_modified( const object& objct )
    object_inserted( objct );
 } FC_CAPTURE_AND_RETHROW( (objct) ) } // GCOVR_EXCL_LINE
 
+void amount_in_collateral_index::publish()
+{
+   if( !_dirty )
+      return;
+   _snapshot.publish( _data );
+   _dirty = false;
+}
+
 share_type amount_in_collateral_index::get_amount_in_collateral( const asset_id_type& asst )const
 { try {
-   auto itr = in_collateral.find( asst );
-   if( itr == in_collateral.end() ) return 0;
+   const auto data = _snapshot.get();
+   auto itr = data->in_collateral.find( asst );
+   if( itr == data->in_collateral.end() ) return 0;
    return itr->second;
 } FC_CAPTURE_AND_RETHROW( (asst) ) } // GCOVR_EXCL_LINE
 
 share_type amount_in_collateral_index::get_backing_collateral( const asset_id_type& asst )const
 { try {
-   auto itr = backing_collateral.find( asst );
-   if( itr == backing_collateral.end() ) return 0;
+   const auto data = _snapshot.get();
+   auto itr = data->backing_collateral.find( asst );
+   if( itr == data->backing_collateral.end() ) return 0;
    return itr->second;
 } FC_CAPTURE_AND_RETHROW( (asst) ) } // GCOVR_EXCL_LINE
 
+void asset_in_liquidity_pools_index::insert_pool( const asset_id_type& a, const liquidity_pool_id_type& pool_id )
+{
+   auto& pools = asset_in_pools_map[ a ]; // Note: [] operator will create an entry if not found
+   auto new_pools = pools ? std::make_shared< flat_set<liquidity_pool_id_type> >( *pools )
+                          : std::make_shared< flat_set<liquidity_pool_id_type> >();
+   new_pools->insert( pool_id );
+   pools = std::move( new_pools );
+   _dirty = true;
+}
+
+void asset_in_liquidity_pools_index::erase_pool( const asset_id_type& a, const liquidity_pool_id_type& pool_id )
+{
+   auto itr = asset_in_pools_map.find( a );
+   if( itr == asset_in_pools_map.end() ) // should not happen
+      return;
+   if( itr->second->size() <= 1 )
+      // Note: readers hold their own snapshots, so it is safe to erase the entry here
+      asset_in_pools_map.erase( itr );
+   else
+   {
+      auto new_pools = std::make_shared< flat_set<liquidity_pool_id_type> >( *itr->second );
+      new_pools->erase( pool_id );
+      itr->second = std::move( new_pools );
+   }
+   _dirty = true;
+}
+
 void asset_in_liquidity_pools_index::object_inserted( const object& objct )
 { try {
    const auto& o = static_cast<const liquidity_pool_object&>( objct );
    const liquidity_pool_id_type pool_id = o.get_id();
-   asset_in_pools_map[ o.asset_a ].insert( pool_id ); // Note: [] operator will create an entry if not found
-   asset_in_pools_map[ o.asset_b ].insert( pool_id );
+   insert_pool( o.asset_a, pool_id );
+   insert_pool( o.asset_b, pool_id );
 } FC_CAPTURE_AND_RETHROW( (objct) ) } // GCOVR_EXCL_LINE
 
 void asset_in_liquidity_pools_index::object_removed( const object& objct )
 { try {
    const auto& o = static_cast<const liquidity_pool_object&>( objct );
    const liquidity_pool_id_type pool_id = o.get_id();
-   asset_in_pools_map[ o.asset_a ].erase( pool_id );
-   asset_in_pools_map[ o.asset_b ].erase( pool_id );
-   // Note: do not erase entries with an empty set from the map in order to avoid read/write race conditions
+   erase_pool( o.asset_a, pool_id );
+   erase_pool( o.asset_b, pool_id );
 } FC_CAPTURE_AND_RETHROW( (objct) ) } // GCOVR_EXCL_LINE
 
 void asset_in_liquidity_pools_index::about_to_modify( const object& objct )
@@ -121,11 +161,22 @@ void asset_in_liquidity_pools_index::object_modified( const object& objct )
    // this secondary index has no interest in the modifications, nothing to do here
 }
 
-const flat_set<liquidity_pool_id_type>& asset_in_liquidity_pools_index::get_liquidity_pools_by_asset(
+void asset_in_liquidity_pools_index::publish()
+{
+   if( !_dirty )
+      return;
+   // Note: only the pointers are copied
+   _snapshot.publish( asset_in_pools_map );
+   _dirty = false;
+}
+
+asset_in_liquidity_pools_index::pool_set_ptr asset_in_liquidity_pools_index::get_liquidity_pools_by_asset(
             const asset_id_type& a )const
 {
-   auto itr = asset_in_pools_map.find( a );
-   if( itr != asset_in_pools_map.end() )
+   static const pool_set_ptr empty_set = std::make_shared< const flat_set<liquidity_pool_id_type> >();
+   const auto pools_map = _snapshot.get();
+   auto itr = pools_map->find( a );
+   if( itr != pools_map->end() )
       return itr->second;
    return empty_set;
 }
@@ -204,14 +255,27 @@ void api_helper_indexes::plugin_startup()
    next_object_ids_idx = database().add_secondary_index< primary_index<simple_index<chain_property_object>>,
                                                         next_object_ids_index >();
    refresh_next_ids();
+   publish_snapshots();
    // connect with no group specified to process after the ones with a group specified
    database().applied_block.connect( [this]( const chain::signed_block& )
    {
       refresh_next_ids();
       _next_ids_map_initialized = true;
+      publish_snapshots();
+   });
+   // changes made by pending transactions are visible to API clients too
+   database().on_pending_transaction.connect( [this]( const chain::signed_transaction& )
+   {
+      publish_snapshots();
    });
 }
 
+void api_helper_indexes::publish_snapshots()
+{
+   amount_in_collateral_idx->publish();
+   asset_in_liquidity_pools_idx->publish();
+}
+
 void api_helper_indexes::refresh_next_ids()
 {
    const auto& db = database();
@@ -221,6 +285,7 @@ void api_helper_indexes::refresh_next_ids()
       {
          item.second = db.get_index( item.first.first, item.first.second ).get_next_id();
       }
+      next_object_ids_idx->_snapshot.publish( next_object_ids_idx->_next_ids );
       return;
    }
 
@@ -245,11 +310,12 @@ void api_helper_indexes::refresh_next_ids()
       }
    }
    dlog( "${count} indexes detected, ${failed_count} not found", ("count",count)("failed_count",failed_count) );
+   next_object_ids_idx->_snapshot.publish( next_object_ids_idx->_next_ids );
 }
 
 object_id_type next_object_ids_index::get_next_id( uint8_t space_id, uint8_t type_id ) const
 { try {
-   return _next_ids.at( std::make_pair( space_id, type_id ) );
+   return _snapshot.get()->at( std::make_pair( space_id, type_id ) );
 } FC_CAPTURE_AND_RETHROW( (space_id)(type_id) ) } // GCOVR_EXCL_LINE
 
 } }
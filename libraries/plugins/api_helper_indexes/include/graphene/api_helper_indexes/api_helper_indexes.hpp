@@ -26,14 +26,40 @@
 #include <graphene/app/plugin.hpp>
 #include <graphene/protocol/types.hpp>
 
+#include <atomic>
+#include <memory>
+
 namespace graphene { namespace api_helper_indexes {
 using namespace chain;
 
+/**
+ *  @brief Holds an immutable snapshot of some data which can be read from any thread.
+ *
+ *  The data is only modified by the thread which applies blocks and transactions, on a private copy owned by
+ *  the secondary index. It is published as a new immutable snapshot with @ref publish, readers (API threads)
+ *  get a shared pointer to the latest published snapshot with a single atomic load, and the snapshot stays
+ *  valid for as long as they hold it. An old snapshot is freed when the last reader releases it.
+ */
+template<typename T>
+class published_snapshot
+{
+   public:
+      published_snapshot() : _snapshot( std::make_shared<const T>() ) {}
+
+      std::shared_ptr<const T> get()const { return std::atomic_load( &_snapshot ); }
+
+      void publish( const T& data ) { std::atomic_store( &_snapshot, std::make_shared<const T>( data ) ); }
+
+   private:
+      std::shared_ptr<const T> _snapshot;
+};
+
 /**
  *  @brief This secondary index tracks how much of each asset is locked up as collateral for MPAs, and how much
  *         collateral is backing an MPA in total.
  *  @note This is implemented with \c flat_map considering there aren't too many MPAs and PMs in the system thus
  *        the performance would be acceptable.
+ *  @note Changes are visible to readers after @ref publish is called.
  */
 class amount_in_collateral_index : public secondary_index
 {
@@ -46,29 +72,53 @@ class amount_in_collateral_index : public secondary_index
       share_type get_amount_in_collateral( const asset_id_type& asset )const;
       share_type get_backing_collateral( const asset_id_type& asset )const;
 
+      /// Publish the changes since last call to readers
+      void publish();
+
    private:
-      flat_map<asset_id_type, share_type> in_collateral;
-      flat_map<asset_id_type, share_type> backing_collateral;
+      struct collateral_data
+      {
+         flat_map<asset_id_type, share_type> in_collateral;
+         flat_map<asset_id_type, share_type> backing_collateral;
+      };
+
+      collateral_data                        _data;
+      bool                                   _dirty = false;
+      published_snapshot<collateral_data>    _snapshot;
 };
 
 /**
  *  @brief This secondary index maintains a map to make it easier to find liquidity pools by any asset in the pool.
  *  @note This is implemented with \c flat_map and \c flat_set considering there aren't too many liquidity pools
  *        in the system thus the performance would be acceptable.
+ *  @note Changes are visible to readers after @ref publish is called.
  */
 class asset_in_liquidity_pools_index: public secondary_index
 {
    public:
+      using pool_set_ptr = std::shared_ptr< const flat_set<liquidity_pool_id_type> >;
+
       void object_inserted( const object& obj ) override;
       void object_removed( const object& obj ) override;
       void about_to_modify( const object& before ) override;
       void object_modified( const object& after ) override;
 
-      const flat_set<liquidity_pool_id_type>& get_liquidity_pools_by_asset( const asset_id_type& a )const;
+      /// Returns a snapshot of the IDs of the liquidity pools which contain the asset, never null
+      pool_set_ptr get_liquidity_pools_by_asset( const asset_id_type& a )const;
+
+      /// Publish the changes since last call to readers
+      void publish();
 
    private:
-      flat_set<liquidity_pool_id_type> empty_set;
-      flat_map<asset_id_type, flat_set<liquidity_pool_id_type>> asset_in_pools_map;
+      void insert_pool( const asset_id_type& a, const liquidity_pool_id_type& pool_id );
+      void erase_pool( const asset_id_type& a, const liquidity_pool_id_type& pool_id );
+
+      /// Sets are immutable once created, so that unchanged sets are shared by consecutive snapshots
+      using pool_map = flat_map<asset_id_type, pool_set_ptr>;
+
+      pool_map                          asset_in_pools_map;
+      bool                              _dirty = false;
+      published_snapshot<pool_map>      _snapshot;
 };
 
 /**
@@ -83,7 +133,10 @@ class next_object_ids_index : public secondary_index
 
    private:
       friend class api_helper_indexes;
-      flat_map< std::pair<uint8_t,uint8_t>, object_id_type > _next_ids;
+      using next_id_map = flat_map< std::pair<uint8_t,uint8_t>, object_id_type >;
+
+      next_id_map                       _next_ids;
+      published_snapshot<next_id_map>   _snapshot;
 };
 
 namespace detail
@@ -115,6 +168,7 @@ class api_helper_indexes : public graphene::app::plugin
 
       bool _next_ids_map_initialized = false;
       void refresh_next_ids();
+      void publish_snapshots();
 };
 
 } } //graphene::template
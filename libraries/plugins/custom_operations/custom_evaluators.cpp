@@ -58,34 +58,36 @@ vector<object_id_type> custom_generic_evaluator::do_apply(const account_storage_
             wlog("Key can't be bigger than ${max} characters", ("max", CUSTOM_OPERATIONS_MAX_KEY_SIZE));
             continue;
          }
-         auto itr = index.find(make_tuple(_account, op.catalog, row.first));
-         if(itr == index.end())
+         optional<stored_json_value> value;
+         if(row.second.valid())
          {
+            // validate the value once here, it is stored in compact form afterwards
             try {
-               const auto& created = _db->create<account_storage_object>(
-                                        [&op, this, &row]( account_storage_object& aso ) {
-                  aso.account = _account;
-                  aso.catalog = op.catalog;
-                  aso.key = row.first;
-                  if(row.second.valid())
-                     aso.value = fc::json::from_string(*row.second);
-               });
-               results.push_back(created.id);
+               value = stored_json_value::from_json(*row.second);
+            }
+            catch(const fc::parse_error_exception& e) {
+               wlog(e.to_detail_string());
+               continue;
             }
-            catch(const fc::parse_error_exception& e) { wlog(e.to_detail_string()); }
+         }
+         auto itr = index.find(make_tuple(_account, op.catalog, row.first));
+         if(itr == index.end())
+         {
+            const auto& created = _db->create<account_storage_object>(
+                                     [&op, this, &row, &value]( account_storage_object& aso ) {
+               aso.account = _account;
+               aso.catalog = op.catalog;
+               aso.key = row.first;
+               aso.value = std::move(value);
+            });
+            results.push_back(created.id);
          }
          else
          {
-            try {
-               _db->modify(*itr, [&row](account_storage_object &aso) {
-                  if(row.second.valid())
-                     aso.value = fc::json::from_string(*row.second);
-                  else
-                     aso.value.reset();
-               });
-               results.push_back(itr->id);
-            }
-            catch(const fc::parse_error_exception& e) { wlog((e.to_detail_string())); }
+            _db->modify(*itr, [&value](account_storage_object &aso) {
+               aso.value = std::move(value);
+            });
+            results.push_back(itr->id);
          }
       }
    }
@@ -23,6 +23,8 @@
  */
 #include <graphene/custom_operations/custom_operations.hpp>
 
+#include <fc/io/json.hpp>
+
 namespace graphene { namespace custom_operations {
 
 void account_storage_map::validate()const
@@ -30,6 +32,31 @@ void account_storage_map::validate()const
    FC_ASSERT(catalog.length() <= CUSTOM_OPERATIONS_MAX_KEY_SIZE && catalog.length() > 0);
 }
 
+stored_json_value stored_json_value::from_json( const string& json_text )
+{
+   stored_json_value result;
+   result.json = fc::json::to_string( fc::json::from_string( json_text ) );
+   return result;
+}
+
+variant stored_json_value::to_variant( uint32_t max_depth )const
+{
+   return fc::json::from_string( json, fc::json::legacy_parser, max_depth );
+}
+
 } } //graphene::custom_operations
 
+namespace fc
+{
+   void to_variant( const graphene::custom_operations::stored_json_value& var,  fc::variant& vo, uint32_t max_depth )
+   {
+      vo = var.to_variant( max_depth );
+   }
+
+   void from_variant( const fc::variant& var,  graphene::custom_operations::stored_json_value& vo, uint32_t max_depth )
+   {
+      vo.json = fc::json::to_string( var, fc::json::stringify_large_ints_and_doubles, max_depth );
+   }
+}
+
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::custom_operations::account_storage_map )
@@ -38,13 +38,37 @@ enum class custom_operations_object_types {
    account_map = 0
 };
 
+/**
+ *  @brief A JSON value which has been validated, kept in compact text form.
+ *
+ *  The value is parsed once when being stored, and is only converted to a variant when it is serialized for
+ *  API clients, so that it takes much less memory than a variant tree.
+ */
+struct stored_json_value
+{
+   stored_json_value() = default;
+
+   /// Validate and normalize the JSON text, throws @c fc::parse_error_exception if it is invalid
+   static stored_json_value from_json( const string& json_text );
+
+   /// Parse the stored value into a variant
+   variant to_variant( uint32_t max_depth = GRAPHENE_MAX_NESTED_OBJECTS )const;
+
+   string as_string()const { return to_variant().as_string(); }
+
+   template<typename T>
+   T as( uint32_t max_depth )const { return to_variant( max_depth ).as<T>( max_depth ); }
+
+   string json; ///< normalized JSON text
+};
+
 struct account_storage_object : public abstract_object<account_storage_object, CUSTOM_OPERATIONS_SPACE_ID,
                                           static_cast<uint8_t>( custom_operations_object_types::account_map )>
 {
    account_id_type account;
    string catalog;
    string key;
-   optional<variant> value;
+   optional<stored_json_value> value;
 };
 
 struct by_account_catalog_key;
@@ -99,6 +123,15 @@ using account_storage_id_type = object_id<account_storage_object::space_id, acco
 
 } } //graphene::custom_operations
 
+FC_REFLECT( graphene::custom_operations::stored_json_value, (json) )
 FC_REFLECT_DERIVED( graphene::custom_operations::account_storage_object, (graphene::db::object),
                     (account)(catalog)(key)(value))
 FC_REFLECT_ENUM( graphene::custom_operations::custom_operations_object_types, (account_map))
+
+namespace fc
+{
+   void to_variant( const graphene::custom_operations::stored_json_value& var,  fc::variant& vo,
+                    uint32_t max_depth = GRAPHENE_MAX_NESTED_OBJECTS );
+   void from_variant( const fc::variant& var,  graphene::custom_operations::stored_json_value& vo,
+                      uint32_t max_depth = GRAPHENE_MAX_NESTED_OBJECTS );
+}
@@ -1,8 +1,11 @@
 
 #include <fc/filesystem.hpp>
+#include <fc/io/raw.hpp>
 #include <fc/optional.hpp>
 #include <fc/variant_object.hpp>
 
+#include <fstream>
+
 #include <graphene/app/application.hpp>
 
 #include <graphene/chain/block_database.hpp>
@@ -26,6 +29,10 @@ class debug_api_impl
       void debug_push_blocks( const std::string& src_filename, uint32_t count );
       void debug_generate_blocks( const std::string& debug_key, uint32_t count );
       void debug_update_object( const fc::variant_object& update );
+      void debug_update_objects( const std::vector< fc::variant_object >& updates );
+      void debug_write_patch_file( const std::string& filename, const std::vector< fc::variant_object >& updates );
+      void debug_apply_patch_file( const std::string& filename );
+      void debug_revert_updates();
       void debug_stream_json_objects( const std::string& filename );
       void debug_stream_json_objects_flush();
       std::shared_ptr< graphene::debug_witness_plugin::debug_witness_plugin > get_plugin();
@@ -106,6 +113,74 @@ void debug_api_impl::debug_update_object( const fc::variant_object& update )
    db->debug_update( update );
 }
 
+void debug_api_impl::debug_update_objects( const std::vector< fc::variant_object >& updates )
+{
+   std::shared_ptr< graphene::chain::database > db = app.chain_database();
+   db->debug_update( updates );
+}
+
+void debug_api_impl::debug_write_patch_file( const std::string& filename,
+                                             const std::vector< fc::variant_object >& updates )
+{
+   std::shared_ptr< graphene::chain::database > db = app.chain_database();
+
+   std::ofstream out( filename, std::ofstream::binary | std::ofstream::out | std::ofstream::trunc );
+   FC_ASSERT( out, "Unable to open ${f} for writing", ("f", filename) );
+
+   graphene::chain::debug_object_patch patch;
+   for( const auto& update : updates )
+   {
+      auto it_id = update.find( "id" );
+      FC_ASSERT( it_id != update.end() );
+      fc::from_variant( it_id->value(), patch.id );
+
+      auto it_action = update.find( "_action" );
+      const std::string action = ( it_action != update.end() ) ? it_action->value().get_string()
+                                                               : ( update.size() == 1 ? "delete" : "write" );
+      if( action == "delete" )
+      {
+         patch.action = graphene::chain::debug_object_patch::remove;
+         patch.data.clear();
+      }
+      else if( action == "update" )
+      {
+         // Only the given fields are stored, so that the patch does not revert fields changed by earlier
+         // updates of the same object when the file is applied
+         const auto& idx = db->get_index( patch.id );
+         idx.get( patch.id );
+         patch.action = graphene::chain::debug_object_patch::update;
+         patch.data = idx.object_fields_to_packed( update, GRAPHENE_MAX_NESTED_OBJECTS );
+      }
+      else
+      {
+         FC_ASSERT( action == "write", "Unsupported action ${a}", ("a", action) );
+         // A write replaces the whole object, which does not depend on the current state
+         const auto& idx = db->get_index( patch.id );
+         auto obj = idx.get( patch.id ).clone();
+         idx.object_default( *obj );
+         idx.object_from_variant( update, *obj, GRAPHENE_MAX_NESTED_OBJECTS );
+         patch.action = graphene::chain::debug_object_patch::write;
+         patch.data = obj->pack();
+      }
+      fc::raw::pack( out, patch );
+   }
+   FC_ASSERT( out, "Error writing ${f}", ("f", filename) );
+   ilog( "Wrote ${n} patches to ${f}", ("n", updates.size())("f", filename) );
+}
+
+void debug_api_impl::debug_apply_patch_file( const std::string& filename )
+{
+   ilog( "Applying the patches of ${f}", ("f", filename) );
+   std::shared_ptr< graphene::chain::database > db = app.chain_database();
+   db->debug_apply_patch_file( fc::path( filename ) );
+}
+
+void debug_api_impl::debug_revert_updates()
+{
+   std::shared_ptr< graphene::chain::database > db = app.chain_database();
+   db->debug_revert_updates();
+}
+
 std::shared_ptr< graphene::debug_witness_plugin::debug_witness_plugin > debug_api_impl::get_plugin()
 {
    return app.get_plugin< graphene::debug_witness_plugin::debug_witness_plugin >( "debug_witness" );
@@ -143,6 +218,26 @@ void debug_api::debug_update_object( fc::variant_object update )
    my->debug_update_object( update );
 }
 
+void debug_api::debug_update_objects( std::vector< fc::variant_object > updates )
+{
+   my->debug_update_objects( updates );
+}
+
+void debug_api::debug_write_patch_file( std::string filename, std::vector< fc::variant_object > updates )
+{
+   my->debug_write_patch_file( filename, updates );
+}
+
+void debug_api::debug_apply_patch_file( std::string filename )
+{
+   my->debug_apply_patch_file( filename );
+}
+
+void debug_api::debug_revert_updates()
+{
+   my->debug_revert_updates();
+}
+
 void debug_api::debug_stream_json_objects( std::string filename )
 {
    my->debug_stream_json_objects( filename );
@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <fc/api.hpp>
 #include <fc/variant_object.hpp>
@@ -59,6 +60,32 @@ class debug_api
        */
       void debug_update_object( fc::variant_object update );
 
+      /**
+       * Directly manipulate many database objects at once, the last block is undone and re-applied only once.
+       */
+      void debug_update_objects( std::vector< fc::variant_object > updates );
+
+      /**
+       * Write updates in the same format as @ref debug_update_object to a binary patch file, which can be applied
+       * quickly with @ref debug_apply_patch_file. "write" updates are stored as whole packed objects, "update"
+       * updates keep only their fields in binary, so that the patches give the same result as the updates in the
+       * same order. Applying the file does not convert anything from JSON.
+       * Only "write", "update" and "delete" actions are supported.
+       */
+      void debug_write_patch_file( std::string filename, std::vector< fc::variant_object > updates );
+
+      /**
+       * Apply all patches in a binary patch file on top of the last block while reading the memory-mapped file,
+       * the last block is undone and re-applied only once. The file must not change until the updates of the
+       * last block are reverted.
+       */
+      void debug_apply_patch_file( std::string filename );
+
+      /**
+       * Revert all updates and patches applied on top of the last block.
+       */
+      void debug_revert_updates();
+
       /**
        * Start a node with given initial path.
        */
@@ -91,6 +118,10 @@ FC_API(graphene::debug_witness::debug_api,
        (debug_push_blocks)
        (debug_generate_blocks)
        (debug_update_object)
+       (debug_update_objects)
+       (debug_write_patch_file)
+       (debug_apply_patch_file)
+       (debug_revert_updates)
        (debug_stream_json_objects)
        (debug_stream_json_objects_flush)
      )
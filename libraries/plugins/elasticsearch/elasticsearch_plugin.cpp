@@ -179,7 +179,7 @@ void elasticsearch_plugin_impl::update_account_histories( const signed_block& b
       vector<authority> other;
       // fee_payer is added here
       operation_get_required_authorities( op.op, impacted, impacted, other,
-                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( db.head_block_time() ) );
+                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( b.timestamp ) );
 
       if( op.op.is_type< account_create_operation >() )
          impacted.insert( account_id_type( op.result.get<object_id_type>() ) );
@@ -188,7 +188,7 @@ void elasticsearch_plugin_impl::update_account_histories( const signed_block& b
       if( HARDFORK_CORE_265_PASSED(b.timestamp) || !op.op.is_type< account_create_operation >() )
       {
          operation_get_impacted_accounts( op.op, impacted,
-                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( db.head_block_time() ) );
+                                          MUST_IGNORE_CUSTOM_OP_REQD_AUTHS( b.timestamp ) );
       }
 
       if( op.result.is_type<extendable_operation_result>() )
@@ -595,6 +595,13 @@ void elasticsearch_plugin::plugin_startup()
    // Nothing to do
 }
 
+void elasticsearch_plugin::plugin_replay_block( const signed_block& b )
+{
+   FC_ASSERT( my->_options.elasticsearch_mode != mode::only_query,
+              "Can not replay the operation log in only_query mode" );
+   my->update_account_histories( b );
+}
+
 static operation_history_object fromEStoOperation(const variant& source)
 {
    operation_history_object result;
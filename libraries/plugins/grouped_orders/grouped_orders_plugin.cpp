@@ -26,6 +26,8 @@
 
 #include <graphene/chain/market_object.hpp>
 
+#include <cmath>
+
 namespace graphene { namespace grouped_orders {
 
 namespace detail
@@ -52,7 +54,7 @@ class grouped_orders_plugin_impl
 class limit_order_group_index : public secondary_index
 {
    public:
-      limit_order_group_index( const flat_set<uint16_t>& groups ) : _tracked_groups( groups ) {};
+      explicit limit_order_group_index( const flat_set<uint16_t>& groups ) : _tracked_groups( groups ) {};
 
       virtual void object_inserted( const object& obj ) override;
       virtual void object_removed( const object& obj ) override;
@@ -62,128 +64,35 @@ class limit_order_group_index : public secondary_index
       const flat_set<uint16_t>& get_tracked_groups() const
       { return _tracked_groups; }
 
-      const map< limit_order_group_key, limit_order_group_data >& get_order_groups() const
-      { return _og_data; }
+      const limit_order_group_book* get_order_group_book( const market_type& market, uint16_t group ) const;
 
    private:
-      void remove_order( const limit_order_object& obj, bool remove_empty = true );
+      void remove_order( const limit_order_object& obj );
 
       /** tracked groups */
       flat_set<uint16_t> _tracked_groups;
 
-      /** maps the group key to group data */
-      map< limit_order_group_key, limit_order_group_data > _og_data;
+      /** maps a market to its group books, one book per tracked group, in the same order as _tracked_groups */
+      map< market_type, vector< limit_order_group_book > > _og_data;
 };
 
 void limit_order_group_index::object_inserted( const object& objct )
 { try {
    const limit_order_object& o = static_cast<const limit_order_object&>( objct );
 
-   auto& idx = _og_data;
-
-   for( uint16_t group : get_tracked_groups() )
+   const market_type market( o.sell_price.base.asset_id, o.sell_price.quote.asset_id );
+   auto itr = _og_data.find( market );
+   if( itr == _og_data.end() )
    {
-      auto create_ogo = [&]() {
-         idx[ limit_order_group_key( group, o.sell_price ) ] = limit_order_group_data( o.sell_price, o.for_sale );
-      };
-      // if idx is empty, insert this order
-      // Note: not capped
-      if( idx.empty() )
-      {
-         create_ogo();
-         continue;
-      }
-
-      // cap the price
-      price capped_price = o.sell_price;
-      price max = o.sell_price.max();
-      price min = o.sell_price.min();
-      bool capped_max = false;
-      bool capped_min = false;
-      if( o.sell_price > max )
-      {
-         capped_price = max;
-         capped_max = true;
-      }
-      else if( o.sell_price < min )
-      {
-         capped_price = min;
-         capped_min = true;
-      }
-      // if idx is not empty, find the group that is next to this order
-      auto itr = idx.lower_bound( limit_order_group_key( group, capped_price ) );
-      bool check_previous = false;
-      if( itr == idx.end() || itr->first.group != group
-            || itr->first.min_price.base.asset_id != o.sell_price.base.asset_id
-            || itr->first.min_price.quote.asset_id != o.sell_price.quote.asset_id )
-         // not same market or group type
-         check_previous = true;
-      else // same market and group type
-      {
-         bool update_max = false;
-         if( capped_price > itr->second.max_price ) // implies itr->min_price <= itr->max_price < max
-         {
-            update_max = true;
-            price max_price = itr->first.min_price * ratio_type( GRAPHENE_100_PERCENT + group, GRAPHENE_100_PERCENT );
-            // max_price should have been capped here
-            if( capped_price > max_price ) // new order is out of range
-               check_previous = true;
-         }
-         if( !check_previous ) // new order is within the range
-         {
-            if( capped_min && o.sell_price < itr->first.min_price )
-            {  // need to update itr->min_price here, if itr is below min, and new order is even lower
-               // TODO improve performance
-               limit_order_group_data data( itr->second.max_price, o.for_sale + itr->second.total_for_sale );
-               idx.erase( itr );
-               idx[ limit_order_group_key( group, o.sell_price ) ] = data;
-            }
-            else
-            {
-               if( update_max || ( capped_max && o.sell_price > itr->second.max_price ) )
-                  itr->second.max_price = o.sell_price; // store real price here, not capped
-               itr->second.total_for_sale += o.for_sale;
-            }
-         }
-      }
-
-      if( check_previous )
-      {
-         if( itr == idx.begin() ) // no previous
-            create_ogo();
-         else
-         {
-            --itr; // should be valid
-            if( itr->first.group != group || itr->first.min_price.base.asset_id != o.sell_price.base.asset_id
-                                          || itr->first.min_price.quote.asset_id != o.sell_price.quote.asset_id )
-               // not same market or group type
-               create_ogo();
-            else // same market and group type
-            {
-               // due to lower_bound, always true: capped_price < itr->first.min_price, so no need to check again,
-               // if new order is in range of itr group, always need to update itr->first.min_price, unless
-               //   o.sell_price is higher than max
-               price min_price = itr->second.max_price / ratio_type( GRAPHENE_100_PERCENT + group, GRAPHENE_100_PERCENT );
-               // min_price should have been capped here
-               if( capped_price < min_price ) // new order is out of range
-                  create_ogo();
-               else if( capped_max && o.sell_price >= itr->first.min_price )
-               {  // itr is above max, and price of new order is even higher
-                  if( o.sell_price > itr->second.max_price )
-                     itr->second.max_price = o.sell_price;
-                  itr->second.total_for_sale += o.for_sale;
-               }
-               else
-               {  // new order is within the range
-                  // TODO improve performance
-                  limit_order_group_data data( itr->second.max_price, o.for_sale + itr->second.total_for_sale );
-                  idx.erase( itr );
-                  idx[ limit_order_group_key( group, o.sell_price ) ] = data;
-               }
-            }
-         }
-      }
+      vector< limit_order_group_book > books;
+      books.reserve( _tracked_groups.size() );
+      for( uint16_t group : _tracked_groups )
+         books.emplace_back( group );
+      itr = _og_data.emplace( market, std::move(books) ).first;
    }
+
+   for( auto& book : itr->second )
+      book.add_order( o.sell_price, o.for_sale );
 } FC_CAPTURE_AND_RETHROW( (objct) ); }
 
 void limit_order_group_index::object_removed( const object& objct )
@@ -195,7 +104,7 @@ void limit_order_group_index::object_removed( const object& objct )
 void limit_order_group_index::about_to_modify( const object& objct )
 { try {
    const limit_order_object& o = static_cast<const limit_order_object&>( objct );
-   remove_order( o, false );
+   remove_order( o );
 } FC_CAPTURE_AND_RETHROW( (objct) ); }
 
 void limit_order_group_index::object_modified( const object& objct )
@@ -203,39 +112,114 @@ void limit_order_group_index::object_modified( const object& objct )
    object_inserted( objct );
 } FC_CAPTURE_AND_RETHROW( (objct) ); }
 
-void limit_order_group_index::remove_order( const limit_order_object& o, bool remove_empty )
+void limit_order_group_index::remove_order( const limit_order_object& o )
 {
-   auto& idx = _og_data;
+   auto itr = _og_data.find( market_type( o.sell_price.base.asset_id, o.sell_price.quote.asset_id ) );
+   if( itr == _og_data.end() )
+   {
+      // should not happen
+      wlog( "can not find the order groups of the market for removing: ${o}", ("o",o) );
+      return;
+   }
 
-   for( uint16_t group : get_tracked_groups() )
+   bool all_empty = true;
+   for( auto& book : itr->second )
    {
-      // find the group that should contain this order
-      auto itr = idx.lower_bound( limit_order_group_key( group, o.sell_price ) );
-      if( itr == idx.end() || itr->first.group != group
-            || itr->first.min_price.base.asset_id != o.sell_price.base.asset_id
-            || itr->first.min_price.quote.asset_id != o.sell_price.quote.asset_id
-            || itr->second.max_price < o.sell_price )
-      {
-         // can not find corresponding group, should not happen
-         wlog( "can not find the order group containing order for removing (price dismatch): ${o}", ("o",o) );
-         continue;
-      }
-      else // found
-      {
-         if( itr->second.total_for_sale < o.for_sale )
-            // should not happen
-            wlog( "can not find the order group containing order for removing (amount dismatch): ${o}", ("o",o) );
-         else if( !remove_empty || itr->second.total_for_sale > o.for_sale )
-            itr->second.total_for_sale -= o.for_sale;
-         else
-            // it's the only order in the group and need to be removed
-            idx.erase( itr );
-      }
+      book.remove_order( o.sell_price, o.for_sale );
+      all_empty = all_empty && book.empty();
    }
+   if( all_empty )
+      _og_data.erase( itr );
+}
+
+const limit_order_group_book* limit_order_group_index::get_order_group_book( const market_type& market,
+                                                                             uint16_t group ) const
+{
+   auto itr = _og_data.find( market );
+   if( itr == _og_data.end() )
+      return nullptr;
+   auto group_itr = _tracked_groups.find( group );
+   if( group_itr == _tracked_groups.end() )
+      return nullptr;
+   return &itr->second[ group_itr - _tracked_groups.begin() ];
 }
 
 } // end namespace detail
 
+limit_order_group_book::limit_order_group_book( uint16_t group )
+   : _group( group ),
+     _log_step( std::log1p( double(group) / GRAPHENE_100_PERCENT ) )
+{
+   FC_ASSERT( group > 0, "Group size must be positive" );
+}
+
+int32_t limit_order_group_book::bucket_of( const price& p )const
+{
+   // Note: floating point is fine here, since the result only affects how orders are presented via API.
+   //       It is deterministic in one process, so an order is always found in the bucket it was added to.
+   const double log_price = std::log( double( p.base.amount.value ) ) - std::log( double( p.quote.amount.value ) );
+   return static_cast<int32_t>( std::floor( log_price / _log_step ) );
+}
+
+void limit_order_group_book::add_order( const price& p, const share_type amount )
+{
+   auto& data = _buckets[ bucket_of( p ) ];
+   if( data.order_count == 0 )
+      data = limit_order_group_data( p, amount );
+   else
+   {
+      if( p < data.min_price )
+         data.min_price = p;
+      else if( p > data.max_price )
+         data.max_price = p;
+      data.total_for_sale += amount;
+   }
+   ++data.order_count;
+}
+
+void limit_order_group_book::remove_order( const price& p, const share_type amount )
+{
+   auto itr = _buckets.find( bucket_of( p ) );
+   if( itr == _buckets.end() )
+   {
+      // can not find corresponding group, should not happen
+      wlog( "can not find the order group containing order for removing (price dismatch): ${p}", ("p",p) );
+      return;
+   }
+
+   auto& data = itr->second;
+   if( data.total_for_sale < amount )
+   {
+      // should not happen
+      wlog( "can not find the order group containing order for removing (amount dismatch): ${p} ${a}",
+            ("p",p)("a",amount) );
+      return;
+   }
+
+   data.total_for_sale -= amount;
+   --data.order_count;
+   if( data.order_count == 0 )
+      _buckets.erase( itr );
+}
+
+vector< limit_order_group_data > limit_order_group_book::get_groups( const optional<price>& start,
+                                                                   uint32_t limit )const
+{
+   vector< limit_order_group_data > result;
+   if( empty() || 0 == limit )
+      return result;
+
+   auto itr = start.valid() ? _buckets.upper_bound( bucket_of( *start ) ) : _buckets.end();
+   while( itr != _buckets.begin() && result.size() < limit )
+   {
+      --itr;
+      const auto& data = itr->second;
+      if( start.valid() && data.min_price > *start )
+         continue;
+      result.push_back( data );
+   }
+   return result;
+}
 
 grouped_orders_plugin::grouped_orders_plugin(graphene::app::application& app) :
    plugin(app),
@@ -290,12 +274,14 @@ const flat_set<uint16_t>& grouped_orders_plugin::tracked_groups() const
    return my->_tracked_groups;
 }
 
-const map< limit_order_group_key, limit_order_group_data >& grouped_orders_plugin::limit_order_groups()
+const limit_order_group_book* grouped_orders_plugin::get_limit_order_group_book( const asset_id_type base,
+                                                                                  const asset_id_type quote,
+                                                                                  uint16_t group )
 {
    const auto& idx = database().get_index_type< limit_order_index >();
    const auto& pidx = dynamic_cast<const primary_index< limit_order_index >&>(idx);
    const auto& logidx = pidx.get_secondary_index< detail::limit_order_group_index >();
-   return logidx.get_order_groups();
+   return logidx.get_order_group_book( market_type( base, quote ), group );
 }
 
 } }
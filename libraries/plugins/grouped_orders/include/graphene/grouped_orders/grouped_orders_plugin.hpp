@@ -29,34 +29,57 @@
 namespace graphene { namespace grouped_orders {
 using namespace chain;
 
-struct limit_order_group_key
-{
-   limit_order_group_key( const uint16_t g, const price& p ) : group(g), min_price(p) {}
-   limit_order_group_key() {}
-
-   uint16_t      group = 0; ///< percentage, 1 means 1 / 10000
-   price         min_price;
-
-   friend bool operator < ( const limit_order_group_key& a, const limit_order_group_key& b )
-   {
-      // price is ordered descendingly, same as limit_order_index
-      return std::tie( a.group, b.min_price ) < std::tie( b.group, a.min_price );
-   }
-   friend bool operator == ( const limit_order_group_key& a, const limit_order_group_key& b )
-   {
-      return std::tie( a.group, a.min_price ) == std::tie( b.group, b.min_price );
-   }
-};
-
+/**
+ *  @brief Summary data of a group of limit orders, i.e. orders in one price bucket
+ */
 struct limit_order_group_data
 {
-   limit_order_group_data( const price& p, const share_type s ) : max_price(p), total_for_sale(s) {}
+   limit_order_group_data( const price& p, const share_type s ) : min_price(p), max_price(p), total_for_sale(s) {}
    limit_order_group_data() {}
 
-   price         max_price;
+   price         min_price; ///< lowest price of the orders added since the group was last empty
+   price         max_price; ///< highest price of the orders added since the group was last empty
    share_type    total_for_sale; ///< asset id is min_price.base.asset_id
+   uint32_t      order_count = 0; ///< number of orders in the group
 };
 
+/**
+ *  @brief Limit orders of one market grouped by one tracked group size.
+ *
+ *  The price axis is split into fixed buckets, bucket N covers prices in [ (1+g)^N, (1+g)^(N+1) ),
+ *  where g is the group size. Only non-empty buckets are stored, ordered by bucket number, so that the memory used
+ *  does not depend on how far apart the prices of the orders are.
+ */
+class limit_order_group_book
+{
+   public:
+      explicit limit_order_group_book( uint16_t group );
+
+      void add_order( const price& p, const share_type amount );
+      void remove_order( const price& p, const share_type amount );
+
+      uint16_t group()const { return _group; }
+      bool empty()const { return _buckets.empty(); }
+
+      /// Returns the number of the bucket which contains the given price
+      int32_t bucket_of( const price& p )const;
+
+      /**
+       *  @brief Get non-empty groups ordered from highest price to lowest
+       *  @param start Optional price, groups whose min_price is higher than it are skipped
+       *  @param limit Maximum number of groups to return
+       */
+      vector< limit_order_group_data > get_groups( const optional<price>& start, uint32_t limit )const;
+
+   private:
+      uint16_t                                   _group;
+      double                                     _log_step;
+      map< int32_t, limit_order_group_data >     _buckets; ///< non-empty buckets by bucket number
+};
+
+/// A market, ordered as (base, quote) of sell prices of the orders in it
+using market_type = std::pair< asset_id_type, asset_id_type >;
+
 namespace detail
 {
     class grouped_orders_plugin_impl;
@@ -82,7 +105,13 @@ class grouped_orders_plugin : public graphene::app::plugin
 
       const flat_set<uint16_t>&   tracked_groups()const;
 
-      const map< limit_order_group_key, limit_order_group_data >& limit_order_groups();
+      /**
+       *  @brief Get grouped orders of a market
+       *  @return the group book, or nullptr if there is no order in the market or the group is not tracked
+       */
+      const limit_order_group_book* get_limit_order_group_book( const asset_id_type base,
+                                                                const asset_id_type quote,
+                                                                uint16_t group );
 
    private:
       std::unique_ptr<detail::grouped_orders_plugin_impl> my;
@@ -90,5 +119,4 @@ class grouped_orders_plugin : public graphene::app::plugin
 
 } } //graphene::grouped_orders
 
-FC_REFLECT( graphene::grouped_orders::limit_order_group_key, (group)(min_price) )
-FC_REFLECT( graphene::grouped_orders::limit_order_group_data, (max_price)(total_for_sale) )
+FC_REFLECT( graphene::grouped_orders::limit_order_group_data, (min_price)(max_price)(total_for_sale)(order_count) )
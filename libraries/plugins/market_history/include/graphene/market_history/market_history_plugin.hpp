@@ -374,6 +374,7 @@ class market_history_plugin : public graphene::app::plugin
       void plugin_initialize(
          const boost::program_options::variables_map& options) override;
       void plugin_startup() override;
+      void plugin_replay_block( const signed_block& b ) override;
 
       uint32_t                    max_history()const;
       const flat_set<uint32_t>&   tracked_buckets()const;
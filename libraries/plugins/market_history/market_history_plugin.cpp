@@ -802,6 +802,11 @@ void market_history_plugin::plugin_startup()
 {
 }
 
+void market_history_plugin::plugin_replay_block( const signed_block& b )
+{
+   my->update_market_histories( b );
+}
+
 const flat_set<uint32_t>& market_history_plugin::tracked_buckets() const
 {
    return my->_tracked_buckets;
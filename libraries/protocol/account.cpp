@@ -170,7 +170,8 @@ void account_options::validate() const
               "May not specify fewer witnesses or committee members than the number voted for.");
 }
 
-share_type account_create_operation::calculate_fee( const fee_params_t& k )const
+share_type account_create_operation::calculate_fee( const fee_params_t& k,
+                                                    const optional<uint64_t>& packed_size )const
 {
    auto core_fee_required = k.basic_fee;
 
@@ -178,7 +179,8 @@ share_type account_create_operation::calculate_fee( const fee_params_t& k )const
       core_fee_required = k.premium_fee;
 
    // Authorities and vote lists can be arbitrarily large, so charge a data fee for big ones
-   auto data_fee =  calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte ); 
+   auto data_fee =  calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                        k.price_per_kbyte );
    core_fee_required += data_fee;
 
    return core_fee_required;
@@ -215,11 +217,13 @@ void account_create_operation::validate()const
    }
 }
 
-share_type account_update_operation::calculate_fee( const fee_params_t& k )const
+share_type account_update_operation::calculate_fee( const fee_params_t& k,
+                                                    const optional<uint64_t>& packed_size )const
 {
    auto core_fee_required = k.fee;  
    if( new_options )
-      core_fee_required += calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte );
+      core_fee_required += calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                               k.price_per_kbyte );
    return core_fee_required;
 }
 
@@ -24,7 +24,10 @@
 #include <graphene/protocol/address.hpp>
 #include <graphene/protocol/pts_address.hpp>
 #include <fc/crypto/base58.hpp>
+#include <fc/crypto/sha256.hpp>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include <fc/io/raw.hpp>
 
@@ -97,6 +100,81 @@ namespace graphene { namespace protocol {
         return GRAPHENE_ADDRESS_PREFIX + fc::to_base58( bin_addr, sizeof(bin_addr) );
    }
 
+   namespace {
+
+   struct public_key_hash
+   {
+      size_t operator()( const public_key_type& key )const
+      {
+         // The key bytes are chosen by whoever submits a transaction, so they are hashed with sha256 to keep
+         // the buckets of the cache from being flooded with colliding keys
+         const auto h = fc::sha256::hash( (const char*)key.key_data.begin(), key.key_data.size() );
+         return static_cast<size_t>( h._hash[0] );
+      }
+   };
+
+   /**
+    * Keeps the derived addresses of the recently used keys in two generations. When the current generation is
+    * full it becomes the previous one, and keys found in the previous generation are moved to the current one.
+    */
+   class key_address_cache
+   {
+      public:
+         key_addresses get( const public_key_type& key )
+         {
+            {
+               std::lock_guard<std::mutex> guard( _mutex );
+               auto itr = _current.find( key );
+               if( itr != _current.end() )
+                  return itr->second;
+               itr = _previous.find( key );
+               if( itr != _previous.end() )
+               {
+                  const key_addresses result = itr->second;
+                  insert( key, result );
+                  return result;
+               }
+            }
+            const key_addresses result = {
+               address( pts_address( key, false, 56 ) ),
+               address( pts_address( key, true,  56 ) ),
+               address( pts_address( key, false, 0 ) ),
+               address( pts_address( key, true,  0 ) ),
+               address( key )
+            };
+            std::lock_guard<std::mutex> guard( _mutex );
+            insert( key, result );
+            return result;
+         }
+
+      private:
+         static constexpr size_t max_generation_size = 1 << 15;
+
+         void insert( const public_key_type& key, const key_addresses& addresses )
+         {
+            if( _current.size() >= max_generation_size )
+            {
+               _previous = std::move( _current );
+               _current.clear();
+            }
+            _current.emplace( key, addresses );
+         }
+
+         using map_type = std::unordered_map< public_key_type, key_addresses, public_key_hash >;
+         std::mutex _mutex;
+         map_type   _current;
+         map_type   _previous;
+   };
+
+   key_address_cache global_key_address_cache;
+
+   } // anonymous namespace
+
+   key_addresses get_key_addresses( const public_key_type& key )
+   {
+      return global_key_address_cache.get( key );
+   }
+
 } } // namespace graphene::protocol
 
 namespace fc
@@ -80,7 +80,8 @@ share_type asset_issue_operation::calculate_fee(const fee_params_t& k)const
 }
 
 share_type asset_create_operation::calculate_fee( const asset_create_operation::fee_params_t& param,
-                                                  const optional<uint64_t>& sub_asset_creation_fee )const
+                                                  const optional<uint64_t>& sub_asset_creation_fee,
+                                                  const optional<uint64_t>& packed_size )const
 {
    share_type core_fee_required = param.long_symbol;
 
@@ -102,7 +103,8 @@ share_type asset_create_operation::calculate_fee( const asset_create_operation::
    }
 
    // common_options contains several lists and a string. Charge fees for its size
-   core_fee_required += calculate_data_fee( fc::raw::pack_size(*this), param.price_per_kbyte );
+   core_fee_required += calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                            param.price_per_kbyte );
 
    return core_fee_required;
 }
@@ -157,9 +159,11 @@ void asset_update_issuer_operation::validate()const
    FC_ASSERT( issuer != new_issuer );
 }
 
-share_type asset_update_operation::calculate_fee(const asset_update_operation::fee_params_t& k)const
+share_type asset_update_operation::calculate_fee( const asset_update_operation::fee_params_t& k,
+                                                  const optional<uint64_t>& packed_size )const
 {
-   return k.fee + calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte );
+   return k.fee + calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                      k.price_per_kbyte );
 }
 
 
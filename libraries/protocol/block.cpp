@@ -77,9 +77,15 @@ namespace graphene { namespace protocol {
       {
          vector<digest_type> ids;
          ids.resize( transactions.size() );
+         // leaf digests are cached in the transactions, usually computed in parallel beforehand
          for( uint32_t i = 0; i < transactions.size(); ++i )
             ids[i] = transactions[i].merkle_digest();
 
+         // a packed pair of digests is just the two digests back to back, so hash adjacent digests in place
+         // instead of packing each pair into the encoder
+         static_assert( sizeof(digest_type) * 2 == sizeof(std::pair<digest_type,digest_type>),
+                        "digests must be contiguous" );
+         static_assert( sizeof(digest_type) == sizeof(digest_type::_hash), "digest must have no padding" );
          vector<digest_type>::size_type current_number_of_hashes = ids.size();
          while( current_number_of_hashes > 1 )
          {
@@ -88,7 +94,7 @@ namespace graphene { namespace protocol {
             uint32_t k = 0;
 
             for( uint32_t i = 0; i < i_max; i += 2 )
-               ids[k++] = digest_type::hash( std::make_pair( ids[i], ids[i+1] ) );
+               ids[k++] = digest_type::hash( reinterpret_cast<const char*>( &ids[i] ), 2 * sizeof(digest_type) );
 
             if( current_number_of_hashes&1 )
                ids[k++] = ids[i_max];
@@ -98,6 +104,98 @@ namespace graphene { namespace protocol {
       }
       return _calculated_merkle_root;
    }
+
+   signed_block::signed_block( const signed_block& b )
+   : signed_block_header( b ), transactions( b.transactions ), _calculated_merkle_root( b._calculated_merkle_root )
+   {
+   }
+
+   signed_block& signed_block::operator=( const signed_block& b )
+   {
+      signed_block_header::operator=( b );
+      transactions = b.transactions;
+      _calculated_merkle_root = b._calculated_merkle_root;
+      _wire_packed_size = 0;
+      return *this;
+   }
+
+   uint64_t signed_block::get_packed_size()const
+   {
+      if( _wire_packed_size > 0 )
+         return _wire_packed_size;
+      return fc::raw::pack_size( *this );
+   }
+
+   void signed_block::unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer,
+                                        fc::datastream<const char*>& ds )
+   {
+      const char* const begin = ds.pos();
+      fc::raw::unpack( ds, static_cast<signed_block_header&>(*this) );
+      fc::unsigned_int count;
+      fc::raw::unpack( ds, count );
+      // the transactions check their own bytes
+      check_canonical_encoding( fc::raw::pack( std::make_pair( static_cast<const signed_block_header&>(*this),
+                                                               count ) ),
+                                begin, ds.pos() );
+      // every transaction takes at least one byte
+      FC_ASSERT( count.value <= ds.remaining(), "Invalid number of transactions" );
+      transactions.clear();
+      transactions.resize( count.value );
+      for( auto& trx : transactions )
+         trx.unpack_from_wire( buffer, ds );
+
+      _block_id = block_id_type();
+      _signee = fc::ecc::public_key();
+      _calculated_merkle_root = checksum_type();
+      _wire_packed_size = ds.pos() - begin;
+   }
+
+   signed_block signed_block::from_wire( vector<char>&& data )
+   {
+      auto buffer = std::make_shared<const vector<char>>( std::move(data) );
+      fc::datastream<const char*> ds( buffer->data(), buffer->size() );
+      signed_block result;
+      result.unpack_from_wire( buffer, ds );
+      return result;
+   }
+
+   signed_block_view::signed_block_view( vector<char>&& data )
+   : _buffer( std::make_shared<const vector<char>>( std::move(data) ) )
+   {
+      fc::datastream<const char*> ds( _buffer->data(), _buffer->size() );
+      fc::raw::unpack( ds, _header );
+      fc::unsigned_int count;
+      fc::raw::unpack( ds, count );
+      // every transaction takes at least one byte
+      FC_ASSERT( count.value <= ds.remaining(), "Invalid number of transactions" );
+      _transaction_count = count.value;
+      _transaction_positions.push_back( ds.pos() - _buffer->data() );
+   }
+
+   processed_transaction signed_block_view::transaction( uint32_t index )const
+   {
+      FC_ASSERT( index < _transaction_count, "Transaction ${i} is not in the block", ("i",index) );
+      size_t i = std::min<size_t>( index, _transaction_positions.size() - 1 );
+      const size_t pos = _transaction_positions[i];
+      fc::datastream<const char*> ds( _buffer->data() + pos, _buffer->size() - pos );
+      for( ; ; ++i )
+      {
+         processed_transaction trx;
+         trx.unpack_from_wire( _buffer, ds );
+         if( i + 1 == _transaction_positions.size() && i + 1 < _transaction_count )
+            _transaction_positions.push_back( ds.pos() - _buffer->data() );
+         if( i == index )
+            return trx;
+      }
+   }
+
+   signed_block signed_block_view::block()const
+   {
+      fc::datastream<const char*> ds( _buffer->data(), _buffer->size() );
+      signed_block result;
+      result.unpack_from_wire( _buffer, ds );
+      return result;
+   }
 } }
 
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::block_header)
@@ -76,10 +76,12 @@ void credit_offer_create_operation::validate()const
    validate_acceptable_borrowers( acceptable_borrowers );
 }
 
-share_type credit_offer_create_operation::calculate_fee( const fee_params_t& schedule )const
+share_type credit_offer_create_operation::calculate_fee( const fee_params_t& schedule,
+                                                         const optional<uint64_t>& packed_size )const
 {
    share_type core_fee_required = schedule.fee;
-   core_fee_required += calculate_data_fee( fc::raw::pack_size(*this), schedule.price_per_kbyte );
+   core_fee_required += calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                            schedule.price_per_kbyte );
    return core_fee_required;
 }
 
@@ -134,10 +136,12 @@ void credit_offer_update_operation::validate()const
               "Should change something - at least one of the optional data fields should be present" );
 }
 
-share_type credit_offer_update_operation::calculate_fee( const fee_params_t& schedule )const
+share_type credit_offer_update_operation::calculate_fee( const fee_params_t& schedule,
+                                                         const optional<uint64_t>& packed_size )const
 {
    share_type core_fee_required = schedule.fee;
-   core_fee_required += calculate_data_fee( fc::raw::pack_size(*this), schedule.price_per_kbyte );
+   core_fee_required += calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                            schedule.price_per_kbyte );
    return core_fee_required;
 }
 
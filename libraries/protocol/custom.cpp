@@ -31,9 +31,10 @@ void custom_operation::validate()const
 {
    FC_ASSERT( fee.amount > 0 );
 }
-share_type custom_operation::calculate_fee(const fee_params_t& k)const
+share_type custom_operation::calculate_fee( const fee_params_t& k, const optional<uint64_t>& packed_size )const
 {
-   return k.fee + calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte );
+   return k.fee + calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                      k.price_per_kbyte );
 }
 
 } }
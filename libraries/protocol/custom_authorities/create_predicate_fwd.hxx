@@ -95,3 +95,14 @@ object_restriction_predicate<unsigned_int> create_predicate_function(
 extern template
 object_restriction_predicate<extensions_type> create_predicate_function(
     restriction_function func, restriction_argument arg );
+
+/* Restrictions on these reflected types are compiled by attribute assertions on many operations, so their
+ * compile_restrictions specializations are also externalized.
+ * ---------------- CUT ---------------- */
+
+extern template
+void compile_restrictions<asset>( restriction_program& program, vector<restriction> rs, bool allow_empty );
+extern template
+void compile_restrictions<price>( restriction_program& program, vector<restriction> rs, bool allow_empty );
+extern template
+void compile_restrictions<authority>( restriction_program& program, vector<restriction> rs, bool allow_empty );
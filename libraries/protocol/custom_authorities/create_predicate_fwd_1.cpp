@@ -64,4 +64,9 @@ template
 object_restriction_predicate<time_point_sec> create_predicate_function(
     restriction_function func, restriction_argument arg );
 
+template
+void compile_restrictions<asset>( restriction_program& program, vector<restriction> rs, bool allow_empty );
+template
+void compile_restrictions<price>( restriction_program& program, vector<restriction> rs, bool allow_empty );
+
 } } // namespace graphene::protocol
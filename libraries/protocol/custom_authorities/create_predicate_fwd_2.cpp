@@ -54,4 +54,7 @@ template
 object_restriction_predicate<optional<authority>> create_predicate_function(
     restriction_function func, restriction_argument arg );
 
+template
+void compile_restrictions<authority>( restriction_program& program, vector<restriction> rs, bool allow_empty );
+
 } } // namespace graphene::protocol
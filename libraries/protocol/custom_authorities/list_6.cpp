@@ -32,12 +32,7 @@ using result_type = object_restriction_predicate<operation>;
 result_type get_restriction_pred_list_6(size_t idx, vector<restriction> rs) {
    return typelist::runtime::dispatch(operation_list_6::list(), idx, [&rs] (auto t) {
       using Op = typename decltype(t)::type;
-      result_type to_return = [p=restrictions_to_predicate<Op>(std::move(rs), true)] (const operation& op) {
-         FC_ASSERT(op.which() == operation::tag<Op>::value,
-                   "Supplied operation is incorrect type for restriction predicate");
-         return p(op.get<Op>());
-      };
-      return to_return;
+      return compile_operation_predicate<Op>(std::move(rs));
    });
 }
 } }
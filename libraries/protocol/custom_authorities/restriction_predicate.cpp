@@ -30,7 +30,7 @@
 namespace graphene { namespace protocol {
 
 restriction_predicate_function get_restriction_predicate(vector<restriction> rs, operation::tag_type op_type) {
-   auto f = typelist::runtime::dispatch(operation::list(), op_type, [&rs](auto t) -> restriction_predicate_function {
+   return typelist::runtime::dispatch(operation::list(), op_type, [&rs](auto t) -> restriction_predicate_function {
       using Op = typename decltype(t)::type;
       if (typelist::contains<operation_list_1::list, Op>())
          return get_restriction_pred_list_1(typelist::index_of<operation_list_1::list, Op>(), std::move(rs));
@@ -63,10 +63,48 @@ restriction_predicate_function get_restriction_predicate(vector<restriction> rs,
                          "LOGIC ERROR: Operation type not handled by custom authorities implementation. "
                          "Please report this error.");
    });
+}
+
+predicate_result restriction_program::evaluate(size_t begin, size_t end, const char* object) const {
+   for (size_t i = begin; i < end; i = steps[i].next) {
+      auto result = evaluate_step(i, object);
+      if (!result) {
+         result.rejection_path.push_back(steps[i].index);
+         return result;
+      }
+   }
+   return predicate_result::Success();
+}
 
-   // Wrap function in a layer that, if the function returns an error, reverses the order of the rejection path. This
-   // is because the order the path is created in, from the top of the call stack to the bottom, is counterintuitive.
-   return [f=std::move(f)](const operation& op) { return f(op).reverse_path(); };
+predicate_result restriction_program::evaluate_step(size_t position, const char* object) const {
+   const step& s = steps[position];
+   const char* field = object + s.offset;
+   switch (s.kind) {
+   case step::check:
+      return s.checker.invoke(s.checker.predicate.get(), field);
+   case step::enter: {
+      const void* value = field;
+      if (s.resolve != nullptr) {
+         predicate_result::rejection_reason reason = predicate_result::predicate_was_false;
+         value = s.resolve(field, reason);
+         if (value == nullptr)
+            return predicate_result::Rejection(reason);
+      }
+      return evaluate(position + 1, s.next, static_cast<const char*>(value));
+   }
+   case step::logical_or: {
+      vector<predicate_result> rejections;
+      for (const auto& branch : s.branches) {
+         auto result = evaluate(branch.first, branch.second, object);
+         if (result)
+            return predicate_result::Success();
+         rejections.push_back(std::move(result));
+      }
+      return predicate_result::Rejection(std::move(rejections));
+   }
+   }
+   FC_THROW_EXCEPTION(fc::assert_exception,
+                      "LOGIC ERROR: Invalid step in restriction program. Please report this error.");
 }
 
 predicate_result& predicate_result::reverse_path() {
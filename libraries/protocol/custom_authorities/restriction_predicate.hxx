@@ -26,6 +26,8 @@
 
 #include <fc/exception/exception.hpp>
 
+#include <memory>
+
 #include "safe_compare.hpp"
 
 namespace graphene { namespace protocol {
@@ -93,26 +95,34 @@ namespace safenum = boost::safe_numerics::safe_compare;
 //
 // As a result, this file is very template heavy, and does a good deal of type manipulation. Its contents are
 // organized as a series of layers, which recursively examine the restrictions and types they apply to, and finally,
-// once all the types have been resolved, a predicate function is created which evaluates the restrictions on an
-// operation.
+// once all the types have been resolved, the restrictions are compiled into a restriction_program which evaluates
+// them on an operation.
+//
+// A restriction_program is a flat list of steps rather than a tree of nested closures. Each step applies to a field
+// found at a byte offset, resolved when the program is compiled, within the object the step's list restricts.
+// Comparisons are the only steps which call through a type-erased function, and they do so exactly once. Attribute
+// assertions, variant assertions and logical ORs are steps whose nested restriction lists are laid out right after
+// them in the program.
 //
 // To give an overview of the logic, the layers stack up like so, from beginning (bottom of file) to end:
-//  - restrictions_to_predicate<Object>() -- takes a vector<restriction> and creates a predicate for each of them,
-//    but returns a single predicate that returns true only if all sub-predicates return true
-//    - create_field_predicate<Object>() -- Resolves which field of Object the restriction is referencing by indexing
-//      into the object's reflected fields with the predicate's member_index
-//    - create_logical_or_predicate<Object>() -- If the predicate is a logical OR function, the predicate does not
-//      specify a field to examine; rather, the predicates in its branches do. Thus this function recurses into
-//      restrictions_to_predicate for each branch of the OR, and combines the resulting predicates in a predicate
-//      which returns true if any branch of the OR passes
-//  - create_predicate_function<Field>() -- switches on restriction type to determine which predicate template to use
-//    going forward
-//    - make_predicate<Predicate, Field, ArgVariant> -- Determines what type the restriction argument is and creates
-//      a predicate functor for that type
-//    - attribute_assertion<Field> -- If the restriction is an attribute assertion, instead of using make_predicate
-//      to create a predicate function, we first recurse into restrictions_to_predicate with Field as the Object
-//    - variant_assertion<Field> -- If the restriction is a variant assertion, instead of using make_predicate, we
-//      recurse into restrictions_to_predicate with the variant value as the Object
+//  - compile_operation_predicate<Op>() -- compiles the restrictions on an operation into a program, and wraps it in
+//    a restriction predicate function
+//  - compile_restrictions<Object>() -- takes a vector<restriction> and appends a step for each of them to the
+//    program; the steps pass only if all of them pass
+//    - compile_field_restriction<Object>() -- Resolves which field of Object the restriction is referencing by
+//      indexing into the object's reflected fields with the predicate's member_index, and records its offset
+//    - compile_logical_or<Object>() -- If the predicate is a logical OR function, the predicate does not specify a
+//      field to examine; rather, the predicates in its branches do. Thus this function recurses into
+//      compile_restrictions for each branch of the OR, and records the branches in a step which passes if any
+//      branch passes
+//  - compile_field_predicate<Field>() -- switches on restriction type to determine which kind of step to create
+//    - create_predicate_function<Field>() -- for comparisons and list functions, creates a predicate on the field
+//      - make_predicate<Predicate, Field, ArgVariant> -- Determines what type the restriction argument is and
+//        creates a predicate functor for that type
+//    - attribute_assertion<Field> -- If the restriction is an attribute assertion, we recurse into
+//      compile_restrictions with Field as the Object
+//    - variant_assertion<Field> -- If the restriction is a variant assertion, we recurse into compile_restrictions
+//      with the variant value as the Object
 //  - embed_argument<Field, Predicate, Argument>() -- Embeds the argument into the predicate if it is a valid type
 //    for the predicate, and throws otherwise.
 //  - predicate_xyz<Argument> -- These are functors implementing the various predicate function types
@@ -371,77 +381,72 @@ struct predicate_has_none<fc::optional<OptionalType>, Argument, void> : predicat
 };
 ////////////////////////////////////////////// END PREDICATE FUNCTORS //////////////////////////////////////////////
 
-// Forward declaration of restrictions_to_predicate, because attribute assertions and logical ORs recurse into it
-template<typename Object> object_restriction_predicate<Object> restrictions_to_predicate(vector<restriction>, bool);
-
-template<typename Field>
-struct attribute_assertion {
-   static object_restriction_predicate<Field> create(vector<restriction>&& rs) {
-      return restrictions_to_predicate<Field>(std::move(rs), false);
-   }
-};
-template<typename Field>
-struct attribute_assertion<fc::optional<Field>> {
-   static object_restriction_predicate<fc::optional<Field>> create(vector<restriction>&& rs) {
-      return [p=restrictions_to_predicate<Field>(std::move(rs), false)](const fc::optional<Field>& f) {
-         if (!f.valid()) return predicate_result::Rejection(predicate_result::null_optional);
-         return p(*f);
-      };
-   }
-};
-template<typename Extension>
-struct attribute_assertion<extension<Extension>> {
-   static object_restriction_predicate<extension<Extension>> create(vector<restriction>&& rs) {
-      return [p=restrictions_to_predicate<Extension>(std::move(rs), false)](const extension<Extension>& x) {
-         return p(x.value);
+/**
+ * @brief A list of restrictions compiled into a flat sequence of steps
+ *
+ * The steps of a restriction list are stored one after the other; steps with nested restriction lists (attribute
+ * assertions, variant assertions and logical ORs) are followed by the steps of their nested lists, and the next step
+ * of the outer list is found at the index stored in the step. The program evaluates objects by address; each step
+ * finds its field at a byte offset from the object its list restricts.
+ */
+class restriction_program {
+public:
+   /// A predicate on a field of a particular type, invoked with the address of the field
+   struct field_check {
+      predicate_result (*invoke)(const void* predicate, const void* field) = nullptr;
+      std::shared_ptr<const void> predicate;
+   };
+   /// Get the address of the value held in a field, or return nullptr and set the reason it cannot be inspected
+   using value_resolver = const void* (*)(const void* field, predicate_result::rejection_reason& reason);
+
+   struct step {
+      enum step_kind : uint8_t {
+         check,     ///< Evaluate a predicate on the field
+         enter,     ///< Evaluate the nested steps on the field or on the value resolved from it
+         logical_or ///< Evaluate the branches on the object; pass if any branch passes
       };
-   }
-};
+      step_kind kind = check;
+      /// Index of the restriction within its list, reported in the rejection path
+      size_t index = 0;
+      /// Byte offset of the field within the object the step applies to
+      size_t offset = 0;
+      /// Index of the next step in the same list, after all nested steps of this one
+      size_t next = 0;
+
+      field_check checker;
+      /// If null, the steps of an enter step are evaluated on the field itself
+      value_resolver resolve = nullptr;
+      /// Ranges of steps of the branches of a logical OR
+      vector<std::pair<size_t, size_t>> branches;
+   };
 
-template<typename Variant>
-struct variant_assertion {
-   static object_restriction_predicate<Variant> create(restriction::variant_assert_argument_type&&) {
-      FC_THROW_EXCEPTION(fc::assert_exception, "Invalid variant assertion on non-variant field",
-                         ("Field", fc::get_typename<Variant>::name()));
-   }
-};
-template<typename... Types>
-struct variant_assertion<static_variant<Types...>> {
-   using Variant = static_variant<Types...>;
+   vector<step> steps;
 
-   template<typename Value>
-   static auto make_predicate(vector<restriction>&& rs) {
-      return [p=restrictions_to_predicate<Value>(std::move(rs), true)](const Variant& v) {
-         if (v.which() == Variant::template tag<Value>::value)
-            return p(v.template get<Value>());
-         return predicate_result::Rejection(predicate_result::incorrect_variant_type);
-      };
-   }
-   static object_restriction_predicate<Variant> create(restriction::variant_assert_argument_type&& arg) {
-      return typelist::runtime::dispatch(typelist::list<Types...>(), arg.first,
-                                         [&arg](auto t) -> object_restriction_predicate<Variant> {
-         using Value = typename decltype(t)::type;
-         return variant_assertion::make_predicate<Value>(std::move(arg.second));
-      });
-   }
-};
-template<typename... Types>
-struct variant_assertion<fc::optional<static_variant<Types...>>> {
-   using Variant = static_variant<Types...>;
-   using Optional = fc::optional<Variant>;
-   static object_restriction_predicate<Optional> create(restriction::variant_assert_argument_type&& arg) {
-      return typelist::runtime::dispatch(typelist::list<Types...>(), arg.first,
-                                         [&arg](auto t) -> object_restriction_predicate<Optional> {
-         using Value = typename decltype(t)::type;
-         auto pred = variant_assertion<Variant>::template make_predicate<Value>(std::move(arg.second));
-         return [p=std::move(pred)](const Optional& opt) {
-            if (!opt.valid()) return predicate_result::Rejection(predicate_result::null_optional);
-            return p(*opt);
-         };
-      });
+   /// Evaluate all steps on an object. The rejection path is ordered from the innermost restriction to the outermost
+   predicate_result evaluate(const void* object) const {
+      return evaluate(0, steps.size(), static_cast<const char*>(object));
    }
+
+private:
+   predicate_result evaluate(size_t begin, size_t end, const char* object) const;
+   predicate_result evaluate_step(size_t position, const char* object) const;
 };
 
+template<typename Field>
+predicate_result invoke_field_predicate(const void* predicate, const void* field) {
+   return (*static_cast<const object_restriction_predicate<Field>*>(predicate))(*static_cast<const Field*>(field));
+}
+template<typename Field>
+restriction_program::field_check make_field_check(object_restriction_predicate<Field> p) {
+   restriction_program::field_check check;
+   check.invoke = &invoke_field_predicate<Field>;
+   check.predicate = std::make_shared<const object_restriction_predicate<Field>>(std::move(p));
+   return check;
+}
+
+// Forward declaration of compile_restrictions, because attribute assertions and logical ORs recurse into it
+template<typename Object> void compile_restrictions(restriction_program&, vector<restriction>, bool);
+
 // Embed the argument into the predicate functor
 template<typename F, typename P, typename A, typename = std::enable_if_t<P::valid>>
 object_restriction_predicate<F> embed_argument(P p, A a, short) {
@@ -496,99 +501,221 @@ object_restriction_predicate<Field> create_predicate_function(restriction_functi
       case restriction::func_has_none:
          return make_predicate<predicate_has_none, Field>(static_variant<list_types_list>
                                                           ::import_from(std::move(arg)));
+      default:
+          FC_THROW_EXCEPTION(fc::assert_exception, "Invalid function type on restriction");
+      }
+   } FC_CAPTURE_AND_RETHROW( (fc::get_typename<Field>::name())(func)(arg) )
+}
+
+#include "create_predicate_fwd.hxx"
+
+/// Get the byte offset of a reflected field within its object, measured once on a default constructed object
+template<typename Object, typename FieldReflection>
+size_t field_offset() {
+   static const size_t offset = [] {
+      const Object sample{};
+      return static_cast<size_t>(reinterpret_cast<const char*>(std::addressof(FieldReflection::get(sample))) -
+                                 reinterpret_cast<const char*>(std::addressof(sample)));
+   }();
+   return offset;
+}
+
+template<typename Field>
+struct attribute_assertion {
+   static void compile(restriction_program& program, size_t position, vector<restriction>&& rs) {
+      program.steps[position].kind = restriction_program::step::enter;
+      compile_restrictions<Field>(program, std::move(rs), false);
+   }
+};
+template<typename Field>
+struct attribute_assertion<fc::optional<Field>> {
+   static const void* resolve(const void* field, predicate_result::rejection_reason& reason) {
+      const auto& opt = *static_cast<const fc::optional<Field>*>(field);
+      if (!opt.valid()) {
+         reason = predicate_result::null_optional;
+         return nullptr;
+      }
+      return std::addressof(*opt);
+   }
+   static void compile(restriction_program& program, size_t position, vector<restriction>&& rs) {
+      program.steps[position].kind = restriction_program::step::enter;
+      program.steps[position].resolve = &resolve;
+      compile_restrictions<Field>(program, std::move(rs), false);
+   }
+};
+template<typename Extension>
+struct attribute_assertion<extension<Extension>> {
+   static const void* resolve(const void* field, predicate_result::rejection_reason&) {
+      return std::addressof(static_cast<const extension<Extension>*>(field)->value);
+   }
+   static void compile(restriction_program& program, size_t position, vector<restriction>&& rs) {
+      program.steps[position].kind = restriction_program::step::enter;
+      program.steps[position].resolve = &resolve;
+      compile_restrictions<Extension>(program, std::move(rs), false);
+   }
+};
+
+template<typename Variant>
+struct variant_assertion {
+   static void compile(restriction_program&, size_t, restriction::variant_assert_argument_type&&) {
+      FC_THROW_EXCEPTION(fc::assert_exception, "Invalid variant assertion on non-variant field",
+                         ("Field", fc::get_typename<Variant>::name()));
+   }
+};
+template<typename... Types>
+struct variant_assertion<static_variant<Types...>> {
+   using Variant = static_variant<Types...>;
+
+   template<typename Value>
+   static const void* resolve(const void* field, predicate_result::rejection_reason& reason) {
+      const auto& v = *static_cast<const Variant*>(field);
+      if (v.which() != Variant::template tag<Value>::value) {
+         reason = predicate_result::incorrect_variant_type;
+         return nullptr;
+      }
+      return std::addressof(v.template get<Value>());
+   }
+   static void compile(restriction_program& program, size_t position,
+                       restriction::variant_assert_argument_type&& arg) {
+      typelist::runtime::dispatch(typelist::list<Types...>(), arg.first, [&program, position, &arg](auto t) {
+         using Value = typename decltype(t)::type;
+         program.steps[position].kind = restriction_program::step::enter;
+         program.steps[position].resolve = &variant_assertion::template resolve<Value>;
+         compile_restrictions<Value>(program, std::move(arg.second), true);
+      });
+   }
+};
+template<typename... Types>
+struct variant_assertion<fc::optional<static_variant<Types...>>> {
+   using Variant = static_variant<Types...>;
+
+   template<typename Value>
+   static const void* resolve(const void* field, predicate_result::rejection_reason& reason) {
+      const auto& opt = *static_cast<const fc::optional<Variant>*>(field);
+      if (!opt.valid()) {
+         reason = predicate_result::null_optional;
+         return nullptr;
+      }
+      return variant_assertion<Variant>::template resolve<Value>(std::addressof(*opt), reason);
+   }
+   static void compile(restriction_program& program, size_t position,
+                       restriction::variant_assert_argument_type&& arg) {
+      typelist::runtime::dispatch(typelist::list<Types...>(), arg.first, [&program, position, &arg](auto t) {
+         using Value = typename decltype(t)::type;
+         program.steps[position].kind = restriction_program::step::enter;
+         program.steps[position].resolve = &variant_assertion::template resolve<Value>;
+         compile_restrictions<Value>(program, std::move(arg.second), true);
+      });
+   }
+};
+
+/// Fill in the step at @p position of the program to evaluate a restriction on a field of type Field
+template<typename Field>
+void compile_field_predicate(restriction_program& program, size_t position, restriction_function func,
+                             restriction_argument arg) {
+   try {
+      switch(func) {
       case restriction::func_attr:
          FC_ASSERT(arg.which() == restriction_argument::tag<vector<restriction>>::value,
                    "Argument type for attribute assertion must be restriction list");
-         return attribute_assertion<Field>::create(std::move(arg.get<vector<restriction>>()));
+         attribute_assertion<Field>::compile(program, position, std::move(arg.get<vector<restriction>>()));
+         break;
       case restriction::func_variant_assert:
          FC_ASSERT(arg.which() == restriction_argument::tag<restriction::variant_assert_argument_type>::value,
                    "Argument type for attribute assertion must be pair of variant tag and restriction list");
-         return variant_assertion<Field>::create(std::move(arg.get<restriction::variant_assert_argument_type>()));
+         variant_assertion<Field>::compile(program, position,
+                                           std::move(arg.get<restriction::variant_assert_argument_type>()));
+         break;
       default:
-          FC_THROW_EXCEPTION(fc::assert_exception, "Invalid function type on restriction");
+         program.steps[position].checker = make_field_check<Field>(create_predicate_function<Field>(func,
+                                                                                                 std::move(arg)));
       }
-   } FC_CAPTURE_AND_RETHROW( (fc::get_typename<Field>::name())(func)(arg) )
+   } FC_CAPTURE_AND_RETHROW( (fc::get_typename<Field>::name())(func) )
 }
 
-#include "create_predicate_fwd.hxx"
-
 /**
- * @brief Create a predicate asserting on the field of the object a restriction is referencing
+ * @brief Append a step asserting on the field of the object a restriction is referencing
  *
  * @tparam Object The type the restriction restricts
  *
- * A restriction specifies requirements about a field of an object. This struct shifts the focus from the object type
- * the restriction references to the particular field type, creates a predicate on that field, and wraps that
- * predicate to accept the object type and invoke the inner predicate on the specified field.
+ * A restriction specifies requirements about a field of an object. This function shifts the focus from the object
+ * type the restriction references to the particular field type, records where the field lives within the object,
+ * and compiles the restriction on that field.
  */
 template<typename Object,
          typename = std::enable_if_t<typelist::length<typename fc::reflector<Object>::native_members>() != 0>>
-object_restriction_predicate<Object> create_field_predicate(restriction&& r, short) {
+void compile_field_restriction(restriction_program& program, restriction&& r, short) {
    using member_list = typename fc::reflector<Object>::native_members;
    FC_ASSERT( r.member_index < static_cast<uint64_t>(typelist::length<member_list>()),
               "Invalid member index ${I} for object ${O}",
               ("I", r.member_index)("O", fc::get_typename<Object>::name()) );
-   auto predicator = [f=r.restriction_type, a=std::move(r.argument)](auto t) -> object_restriction_predicate<Object> {
+   const size_t position = program.steps.size();
+   program.steps.emplace_back();
+   auto compiler = [&program, position, f=r.restriction_type, &a=r.argument](auto t) {
       using FieldReflection = typename decltype(t)::type;
       using Field = typename FieldReflection::type;
-      auto p = create_predicate_function<Field>(static_cast<restriction_function>(f), std::move(a));
-      return [p=std::move(p)](const Object& o) { return p(FieldReflection::get(o)); };
+      program.steps[position].offset = field_offset<Object, FieldReflection>();
+      compile_field_predicate<Field>(program, position, static_cast<restriction_function>(f), std::move(a));
    };
-   return typelist::runtime::dispatch(member_list(), static_cast<size_t>(r.member_index.value), predicator);
+   typelist::runtime::dispatch(member_list(), static_cast<size_t>(r.member_index.value), compiler);
+   program.steps[position].next = program.steps.size();
 }
 template<typename Object>
-object_restriction_predicate<Object> create_field_predicate(restriction&&, long) {
+void compile_field_restriction(restriction_program&, restriction&&, long) {
    FC_THROW_EXCEPTION(fc::assert_exception, "Invalid restriction references member of non-object type: ${O}",
                       ("O", fc::get_typename<Object>::name()));
 }
 
 template<typename Object>
-object_restriction_predicate<Object> create_logical_or_predicate(vector<vector<restriction>> rs) {
+void compile_logical_or(restriction_program& program, vector<vector<restriction>> rs) {
    FC_ASSERT(rs.size() > 1, "Logical OR must have at least two branches");
-   auto to_predicate = std::bind(restrictions_to_predicate<Object>, std::placeholders::_1, false);
-
-   vector<object_restriction_predicate<Object>> predicates;
-   std::transform(std::make_move_iterator(rs.begin()), std::make_move_iterator(rs.end()),
-                  std::back_inserter(predicates), to_predicate);
-
-   return [predicates=std::move(predicates)](const Object& obj) {
-      vector<predicate_result> rejections;
-      bool success = std::any_of(predicates.begin(), predicates.end(),
-                                 [o=std::cref(obj), &rejections](const auto& p) {
-         auto result = p(o);
-         if (!result) rejections.push_back(std::move(result));
-         return !!result;
-      });
-      if (success) return predicate_result::Success();
-      return predicate_result::Rejection(std::move(rejections));
-   };
+
+   const size_t position = program.steps.size();
+   program.steps.emplace_back();
+   program.steps[position].kind = restriction_program::step::logical_or;
+
+   vector<std::pair<size_t, size_t>> branches;
+   for (vector<restriction>& branch : rs) {
+      const size_t begin = program.steps.size();
+      compile_restrictions<Object>(program, std::move(branch), false);
+      branches.emplace_back(begin, program.steps.size());
+   }
+   program.steps[position].branches = std::move(branches);
+   program.steps[position].next = program.steps.size();
 }
 
 template<typename Object>
-object_restriction_predicate<Object> restrictions_to_predicate(vector<restriction> rs, bool allow_empty) {
+void compile_restrictions(restriction_program& program, vector<restriction> rs, bool allow_empty) {
    if (!allow_empty)
       FC_ASSERT(!rs.empty(), "Empty attribute assertions and logical OR branches are not permitted");
 
-   vector<object_restriction_predicate<Object>> predicates;
-   std::transform(std::make_move_iterator(rs.begin()), std::make_move_iterator(rs.end()),
-                  std::back_inserter(predicates), [](restriction&& r) {
+   for (size_t i = 0; i < rs.size(); ++i) {
+      restriction& r = rs[i];
+      const size_t position = program.steps.size();
       if (r.restriction_type.value == restriction::func_logical_or) {
           FC_ASSERT(r.argument.which() == restriction_argument::tag<vector<vector<restriction>>>::value,
                     "Restriction argument for logical OR function type must be list of restriction lists.");
-          return create_logical_or_predicate<Object>(std::move(r.argument.get<vector<vector<restriction>>>()));
+          compile_logical_or<Object>(program, std::move(r.argument.get<vector<vector<restriction>>>()));
+      } else {
+          compile_field_restriction<Object>(program, std::move(r), short());
       }
-      return create_field_predicate<Object>(std::move(r), short());
-   });
+      program.steps[position].index = i;
+   }
+}
 
-   return [predicates=std::move(predicates)](const Object& obj) {
-      for (size_t i = 0; i < predicates.size(); ++i) {
-         auto result = predicates[i](obj);
-         if (!result) {
-            result.rejection_path.push_back(i);
-            return result;
-         }
-      }
-      return predicate_result::Success();
+/// Compile restrictions on an operation of type Op into a predicate on operations
+template<typename Op>
+object_restriction_predicate<operation> compile_operation_predicate(vector<restriction> rs) {
+   auto program = std::make_shared<restriction_program>();
+   compile_restrictions<Op>(*program, std::move(rs), true);
+   return [program=std::shared_ptr<const restriction_program>(std::move(program))](const operation& op) {
+      FC_ASSERT(op.which() == operation::tag<Op>::value,
+                "Supplied operation is incorrect type for restriction predicate");
+      // The order the path is created in, from the innermost restriction to the outermost, is counterintuitive, so
+      // reverse it
+      auto result = program->evaluate(std::addressof(op.get<Op>()));
+      result.reverse_path();
+      return result;
    };
 }
 
@@ -26,29 +26,68 @@
 
 #include <fc/uint128.hpp>
 
+#include <algorithm>
+
 namespace graphene { namespace protocol {
 
+   fee_parameters::flat_set_type::const_iterator find_fee_parameters( const fee_parameters::flat_set_type& parameters,
+                                                                      fee_parameters::tag_type tag )
+   {
+      if( tag < 0 )
+         return parameters.end();
+      // Without duplicates, the parameters with the tag can not be after the position of the tag
+      auto last = parameters.end();
+      if( static_cast<uint64_t>( tag ) < parameters.size() )
+      {
+         last = parameters.begin() + tag;
+         if( last->which() == tag )
+            return last;
+      }
+      auto itr = std::lower_bound( parameters.begin(), last, tag,
+                                   []( const fee_parameters& p, fee_parameters::tag_type t ) {
+                                      return p.which() < t;
+                                   } );
+      if( itr != last && itr->which() == tag )
+         return itr;
+      return parameters.end();
+   }
+
    struct calc_fee_visitor
    {
       using result_type = uint64_t;
 
       const fee_schedule& param;
       const operation::tag_type current_op;
-      calc_fee_visitor( const fee_schedule& p, const operation& op ):param(p),current_op(op.which())
+      const optional<uint64_t> packed_size; ///< packed size of the operation if it is known already
+      calc_fee_visitor( const fee_schedule& p, const operation& op, const optional<uint64_t>& size = {} )
+      :param(p),current_op(op.which()),packed_size(size)
       { /* Nothing else to do */ }
 
+      /// Operations with data fees accept their packed size, so that they do not need to pack themselves again
+      template<typename OpType>
+      auto calculate( const OpType& op, const typename OpType::fee_params_t& k, int )const
+         -> decltype( op.calculate_fee( k, packed_size ) )
+      {
+         return op.calculate_fee( k, packed_size );
+      }
+      template<typename OpType>
+      share_type calculate( const OpType& op, const typename OpType::fee_params_t& k, long )const
+      {
+         return op.calculate_fee( k );
+      }
+
       template<typename OpType>
       result_type operator()( const OpType& op )const
       {
          try {
-            return op.calculate_fee( param.get<OpType>() ).value;
+            return calculate( op, param.get<OpType>(), 0 ).value;
          } catch (fc::assert_exception& e) {
              fee_parameters params;
              params.set_which(current_op);
-             auto itr = param.parameters.find(params);
+             auto itr = find_fee_parameters( param.parameters, current_op );
              if( itr != param.parameters.end() )
                 params = *itr;
-             return op.calculate_fee( params.get<typename OpType::fee_params_t>() ).value;
+             return calculate( op, params.get<typename OpType::fee_params_t>(), 0 ).value;
          }
       }
    };
@@ -73,12 +112,21 @@ namespace graphene { namespace protocol {
       asset_create_operation::fee_params_t old_asset_creation_fee_params;
       if( param.exists<asset_create_operation>() )
          old_asset_creation_fee_params = param.get<asset_create_operation>();
-      return op.calculate_fee( old_asset_creation_fee_params, sub_asset_creation_fee ).value;
+      return op.calculate_fee( old_asset_creation_fee_params, sub_asset_creation_fee, packed_size ).value;
    }
 
    asset fee_schedule::calculate_fee( const operation& op )const
    {
-      uint64_t required_fee = op.visit( calc_fee_visitor( *this, op ) );
+      return scale_fee( op.visit( calc_fee_visitor( *this, op ) ) );
+   }
+
+   asset fee_schedule::calculate_fee( const operation& op, uint64_t packed_op_size )const
+   {
+      return scale_fee( op.visit( calc_fee_visitor( *this, op, packed_op_size ) ) );
+   }
+
+   asset fee_schedule::scale_fee( uint64_t required_fee )const
+   {
       if( scale != GRAPHENE_100_PERCENT )
       {
          auto scaled = fc::uint128_t(required_fee) * scale;
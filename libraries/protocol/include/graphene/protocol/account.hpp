@@ -114,7 +114,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return registrar; }
       void            validate()const;
-      share_type      calculate_fee(const fee_params_t& )const;
+      share_type      calculate_fee( const fee_params_t& k,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
 
       void get_required_active_authorities( flat_set<account_id_type>& a )const
       {
@@ -163,7 +164,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return account; }
       void       validate()const;
-      share_type calculate_fee( const fee_params_t& k )const;
+      share_type calculate_fee( const fee_params_t& k,
+                                const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
 
       bool is_owner_update()const
       { return owner || extensions.value.owner_special_authority.valid(); }
@@ -28,6 +28,8 @@
 #include <fc/crypto/elliptic.hpp>
 #include <fc/crypto/ripemd160.hpp>
 
+#include <array>
+
 namespace graphene { namespace protocol {
    struct pts_address;
 
@@ -67,6 +69,17 @@ namespace graphene { namespace protocol {
    inline bool operator == ( const public_key_type& a, const address& b ) { return address(a) == b; }
    inline bool operator == ( const address& a, const public_key_type& b ) { return a == address(b); }
 
+   /// The addresses which refer to a public key in address based authorities, see @ref get_key_addresses
+   using key_addresses = std::array<address, 5>;
+
+   /**
+    * @brief Get the addresses which refer to a public key in address based authorities
+    *
+    * These are the PTS addresses of the compressed and uncompressed key with version 56 and 0, and the address
+    * of the key. Deriving them takes ten hashes, so the results are kept in a bounded process-wide cache.
+    */
+   key_addresses get_key_addresses( const public_key_type& key );
+
 } } // namespace graphene::protocol
 
 namespace fc
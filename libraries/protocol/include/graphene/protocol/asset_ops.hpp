@@ -222,7 +222,8 @@ namespace graphene { namespace protocol {
       account_id_type fee_payer()const { return issuer; }
       void            validate()const;
       share_type      calculate_fee( const fee_params_t& k,
-                                     const optional<uint64_t>& sub_asset_creation_fee )const;
+                                     const optional<uint64_t>& sub_asset_creation_fee,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
    };
 
    /**
@@ -378,7 +379,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return issuer; }
       void            validate()const;
-      share_type      calculate_fee(const fee_params_t& k)const;
+      share_type      calculate_fee( const fee_params_t& k,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
    };
 
    /**
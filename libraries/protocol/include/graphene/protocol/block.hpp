@@ -64,10 +64,64 @@ namespace graphene { namespace protocol {
    class signed_block : public signed_block_header
    {
    public:
+      signed_block() = default;
+      /// Copies do not take over the packed size of the wire bytes, so that their transactions can be changed
+      signed_block( const signed_block& b );
+      signed_block( signed_block&& b ) = default;
+      signed_block& operator=( const signed_block& b );
+      signed_block& operator=( signed_block&& b ) = default;
+
       const checksum_type& calculate_merkle_root()const;
+      /// Packed size of the block, taken from the wire bytes if the block was unpacked by @ref unpack_from_wire
+      uint64_t get_packed_size()const;
       vector<processed_transaction> transactions;
+
+      /**
+       * @brief Unpack the block from its wire bytes
+       *
+       * The packed size of the block, and the IDs, digests and packed sizes of the transactions are computed
+       * from the wire bytes directly, so that applying the block does not need to hash repacked transactions.
+       * Bytes which are not the canonical encoding of the block are rejected.
+       * See @ref precomputable_transaction::unpack_from_wire.
+       *
+       * @param buffer the bytes @p ds reads from, shared so that the transactions can retain them
+       * @param ds the stream positioned at the packed block, it is advanced past the block
+       */
+      void unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer, fc::datastream<const char*>& ds );
+      /// Unpack a block which occupies all of @p data, see @ref unpack_from_wire
+      static signed_block from_wire( vector<char>&& data );
    protected:
       mutable checksum_type   _calculated_merkle_root;
+      uint64_t                _wire_packed_size = 0;
+   };
+
+   /**
+    * @brief Read-only access to a packed block which unpacks only what is asked for
+    *
+    * The header and the number of transactions are unpacked when the view is created. Transactions are unpacked
+    * on demand. They are not prefixed by their sizes, so finding a transaction unpacks the transactions before it
+    * once, but never the ones after it.
+    */
+   class signed_block_view
+   {
+   public:
+      /// Create a view of a block which occupies all of @p data
+      explicit signed_block_view( vector<char>&& data );
+
+      const signed_block_header& header()const { return _header; }
+      uint32_t                   transaction_count()const { return _transaction_count; }
+      /// Unpack the transaction at @p index, see @ref precomputable_transaction::unpack_from_wire
+      processed_transaction      transaction( uint32_t index )const;
+      /// Unpack the whole block, see @ref signed_block::unpack_from_wire
+      signed_block               block()const;
+      const vector<char>&        packed()const { return *_buffer; }
+
+   private:
+      std::shared_ptr<const vector<char>> _buffer;
+      signed_block_header                 _header;
+      uint32_t                            _transaction_count = 0;
+      /// Positions of the transactions which have been found so far, the first one is known from the start
+      mutable vector<size_t>              _transaction_positions;
    };
 
 } } // graphene::protocol
@@ -60,7 +60,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return owner_account; }
       void            validate()const override;
-      share_type      calculate_fee(const fee_params_t& k)const;
+      share_type      calculate_fee( const fee_params_t& k,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
    };
 
    /**
@@ -112,7 +113,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return owner_account; }
       void            validate()const override;
-      share_type      calculate_fee(const fee_params_t& k)const;
+      share_type      calculate_fee( const fee_params_t& k,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
    };
 
    /// Defines automatic repayment types
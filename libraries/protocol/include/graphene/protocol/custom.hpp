@@ -50,7 +50,8 @@ namespace graphene { namespace protocol {
 
       account_id_type   fee_payer()const { return payer; }
       void              validate()const;
-      share_type        calculate_fee(const fee_params_t& k)const;
+      share_type        calculate_fee( const fee_params_t& k,
+                                       const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
       void              get_required_active_authorities( flat_set<account_id_type>& auths )const {
          auths.insert( required_auths.begin(), required_auths.end() );
       }
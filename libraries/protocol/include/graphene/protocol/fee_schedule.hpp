@@ -34,12 +34,31 @@ namespace graphene { namespace protocol {
    };
    using fee_parameters = transform_to_fee_parameters<operation>::type;
 
+   /**
+    * @brief Find the fee parameters with the given tag in a fee schedule
+    *
+    * The parameters are sorted by tag without duplicates, and the tag of the parameters of an operation type is
+    * the tag of the operation type. When the schedule contains the parameters of all operation types, which is the
+    * usual case, they are found at the position of their tag without searching.
+    *
+    * @return an iterator to the parameters, or the end of @p parameters if they are not in the schedule
+    */
+   fee_parameters::flat_set_type::const_iterator find_fee_parameters( const fee_parameters::flat_set_type& parameters,
+                                                                      fee_parameters::tag_type tag );
+
+   /// Find the fee parameters of an operation type, see @ref find_fee_parameters
+   template<typename Operation>
+   fee_parameters::flat_set_type::const_iterator find_fee_parameters( const fee_parameters::flat_set_type& parameters )
+   {
+      return find_fee_parameters( parameters, fee_parameters::tag<typename Operation::fee_params_t>::value );
+   }
+
    template<typename Operation>
    class fee_helper {
      public:
       const typename Operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( typename Operation::fee_params_t() );
+         auto itr = find_fee_parameters<Operation>( parameters );
          FC_ASSERT( itr != parameters.end() );
          return itr->template get<typename Operation::fee_params_t>();
       }
@@ -50,7 +69,7 @@ namespace graphene { namespace protocol {
      public:
       const account_create_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( account_create_operation::fee_params_t() );
+         auto itr = find_fee_parameters<account_create_operation>( parameters );
          FC_ASSERT( itr != parameters.end() );
          return itr->get<account_create_operation::fee_params_t>();
       }
@@ -67,7 +86,7 @@ namespace graphene { namespace protocol {
      public:
       const bid_collateral_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( bid_collateral_operation::fee_params_t() );
+         auto itr = find_fee_parameters<bid_collateral_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<bid_collateral_operation::fee_params_t>();
 
@@ -82,7 +101,7 @@ namespace graphene { namespace protocol {
      public:
       const asset_update_issuer_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( asset_update_issuer_operation::fee_params_t() );
+         auto itr = find_fee_parameters<asset_update_issuer_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<asset_update_issuer_operation::fee_params_t>();
 
@@ -97,7 +116,7 @@ namespace graphene { namespace protocol {
      public:
       const asset_claim_pool_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( asset_claim_pool_operation::fee_params_t() );
+         auto itr = find_fee_parameters<asset_claim_pool_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<asset_claim_pool_operation::fee_params_t>();
 
@@ -132,7 +151,7 @@ namespace graphene { namespace protocol {
      public:
       const htlc_create_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( htlc_create_operation::fee_params_t() );
+         auto itr = find_fee_parameters<htlc_create_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<htlc_create_operation::fee_params_t>();
 
@@ -146,7 +165,7 @@ namespace graphene { namespace protocol {
      public:
       const htlc_redeem_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( htlc_redeem_operation::fee_params_t() );
+         auto itr = find_fee_parameters<htlc_redeem_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<htlc_redeem_operation::fee_params_t>();
 
@@ -159,7 +178,7 @@ namespace graphene { namespace protocol {
      public:
       const htlc_extend_operation::fee_params_t& cget(const fee_parameters::flat_set_type& parameters)const
       {
-         auto itr = parameters.find( htlc_extend_operation::fee_params_t() );
+         auto itr = find_fee_parameters<htlc_extend_operation>( parameters );
          if ( itr != parameters.end() )
             return itr->get<htlc_extend_operation::fee_params_t>();
 
@@ -185,6 +204,12 @@ namespace graphene { namespace protocol {
        *  implicitly by core_exchange_rate.
        */
       asset calculate_fee( const operation& op, const price& core_exchange_rate )const;
+      /**
+       *  Same as calculate_fee( op ), but the data fees of the operation are calculated with the given
+       *  packed size of the operation, e.g. one cached by @ref precomputable_transaction, instead of
+       *  packing the operation again.
+       */
+      asset calculate_fee( const operation& op, uint64_t packed_op_size )const;
       /**
        *  Updates the operation with appropriate fee and returns the fee.
        */
@@ -210,8 +235,7 @@ namespace graphene { namespace protocol {
       template<typename Operation>
       bool exists()const
       {
-         auto itr = parameters.find(typename Operation::fee_params_t());
-         return itr != parameters.end();
+         return find_fee_parameters<Operation>( parameters ) != parameters.end();
       }
 
       /**
@@ -221,6 +245,8 @@ namespace graphene { namespace protocol {
       uint32_t                      scale = GRAPHENE_100_PERCENT; ///< fee * scale / GRAPHENE_100_PERCENT
    private:
       static fee_schedule get_default_impl();
+      /// Applies @ref scale to a fee in CORE asset
+      asset scale_fee( uint64_t required_fee )const;
    };
 
    using fee_schedule_type = fee_schedule;
@@ -147,6 +147,18 @@ namespace graphene { namespace protocol {
 
    void operation_validate( const operation& op );
 
+   /**
+    * @return whether validating @p op is expensive enough, e.g. because it verifies commitments on elliptic curves,
+    *         to be worth doing separately from the rest of its transaction
+    */
+   bool operation_has_expensive_validation( const operation& op );
+
+   /**
+    * @return the name of the type of operation at index @p which of @ref operation without its namespace,
+    *         e.g. "transfer_operation"
+    */
+   const std::string& operation_name( int64_t which );
+
    /**
     *  @brief necessary to support nested operations inside the proposal_create_operation
     */
@@ -95,7 +95,8 @@ namespace graphene { namespace protocol {
 
        account_id_type fee_payer()const { return fee_paying_account; }
        void            validate()const;
-       share_type      calculate_fee(const fee_params_t& k)const;
+       share_type      calculate_fee( const fee_params_t& k,
+                                      const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
    };
 
    /**
@@ -136,7 +137,8 @@ namespace graphene { namespace protocol {
 
       account_id_type fee_payer()const { return fee_paying_account; }
       void            validate()const;
-      share_type      calculate_fee(const fee_params_t& k)const;
+      share_type      calculate_fee( const fee_params_t& k,
+                                     const optional<uint64_t>& packed_size = optional<uint64_t>() )const;
       void get_required_authorities( vector<authority>& )const;
       void get_required_active_authorities( flat_set<account_id_type>& )const;
       void get_required_owner_authorities( flat_set<account_id_type>& )const;
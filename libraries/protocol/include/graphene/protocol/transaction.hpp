@@ -24,8 +24,13 @@
 #pragma once
 #include <graphene/protocol/operations.hpp>
 
+#include <fc/io/datastream.hpp>
+
+#include <memory>
+
 namespace graphene { namespace protocol {
    struct predicate_result;
+   class authority_satisfaction_cache;
 
    using rejected_predicate = static_variant<predicate_result, fc::exception>;
    using rejected_predicate_map = map<custom_authority_id_type, rejected_predicate>;
@@ -121,6 +126,8 @@ namespace graphene { namespace protocol {
                                      bool ignore_custom_operation_required_auths )const;
 
       virtual uint64_t get_packed_size()const;
+      /// Packed size of the operation at @p op_index without its tag, which is the size its data fees are charged for
+      virtual uint64_t get_operation_packed_size( size_t op_index )const;
 
    protected:
       // Calculate the digest used for signature validation
@@ -174,6 +181,8 @@ namespace graphene { namespace protocol {
        *            required_auths field of custom_operation or not
        * @param max_recursion maximum level of recursion when verifying, since an account
        *            can have another account in active authorities and/or owner authorities
+       * @param cache if not null, remembers which accounts are satisfied by the signature keys,
+       *            see @ref authority_satisfaction_cache
        */
       void verify_authority(
               const chain_id_type& chain_id,
@@ -182,7 +191,8 @@ namespace graphene { namespace protocol {
               const custom_authority_lookup& get_custom,
               bool allow_non_immediate_owner,
               bool ignore_custom_operation_required_auths,
-              uint32_t max_recursion = GRAPHENE_MAX_SIG_CHECK_DEPTH )const;
+              uint32_t max_recursion = GRAPHENE_MAX_SIG_CHECK_DEPTH,
+              authority_satisfaction_cache* cache = nullptr )const;
 
       /**
        * This is a slower replacement for get_required_signatures()
@@ -222,6 +232,9 @@ namespace graphene { namespace protocol {
       /** Removes all signatures */
       void clear_signatures() { signatures.clear(); }
    protected:
+      /** Extract public keys from signatures with given signature digest and store them in @ref _signees */
+      const flat_set<public_key_type>& extract_signature_keys( const digest_type& sig_digest )const;
+
       /** Public keys extracted from signatures */
       mutable flat_set<public_key_type> _signees;
    };
@@ -241,9 +254,73 @@ namespace graphene { namespace protocol {
       virtual void                             validate()const override;
       virtual const flat_set<public_key_type>& get_signature_keys( const chain_id_type& chain_id )const override;
       virtual uint64_t                         get_packed_size()const override;
+      virtual uint64_t                         get_operation_packed_size( size_t op_index )const override;
+
+      /**
+       * @brief Validate the transaction except for its operations which are expensive to validate
+       *
+       * See @ref operation_has_expensive_validation. If the transaction contains any such operation, it is not
+       * marked as validated: the caller validates them separately, e.g. in parallel, with @ref operation_validate
+       * and then calls @ref set_validated. Otherwise this is the same as @ref validate.
+       */
+      void validate_except_expensive_operations()const;
+      /// Mark the transaction as validated after all of its operations have been validated separately
+      void set_validated()const { _validated = true; }
+
+      /**
+       * @brief Unpack the transaction from its wire bytes
+       *
+       * The ID and the packed size are computed from the wire bytes directly instead of repacking the
+       * transaction. The wire bytes are retained until the signature keys are extracted, so that the
+       * signature digest does not need to repack the transaction either. Bytes which are not the canonical
+       * encoding of the transaction are rejected, since the derived values would differ from those of a repack.
+       *
+       * @param buffer the bytes @p ds reads from, shared so that they can be retained
+       * @param ds the stream positioned at the packed transaction, it is advanced past the transaction
+       */
+      void unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer, fc::datastream<const char*>& ds );
    protected:
       mutable bool _validated = false;
       mutable uint64_t _packed_size = 0;
+      mutable vector<uint64_t> _operation_packed_sizes;
+      /** Wire bytes of the transaction without signatures, only set by @ref unpack_from_wire */
+      mutable std::shared_ptr<const vector<char>> _wire_buffer;
+      mutable const char*                         _wire_trx = nullptr;
+   };
+
+   /**
+    * @brief Remembers whether the authorities of accounts are satisfied by sets of signature keys
+    *
+    * It is used by @ref verify_authority to skip walking the authorities of an account again when another
+    * transaction is signed by the same set of keys. The owner of the cache must @ref clear it whenever the
+    * authorities of any account change. The cache is not thread-safe.
+    */
+   class authority_satisfaction_cache
+   {
+   public:
+      /// Result of checking the active authority of an account, with fallback to its owner authority
+      struct result
+      {
+         bool                       satisfied = false;
+         flat_set<public_key_type>  used_keys; ///< signature keys counted by the check
+         flat_set<account_id_type>  approved;  ///< accounts found to be approved by the check
+      };
+
+      /// Returns nullptr if the result is unknown
+      const result* find( const flat_set<public_key_type>& sigs, account_id_type account,
+                          bool allow_non_immediate_owner, uint32_t max_recursion )const;
+      const result& store( const flat_set<public_key_type>& sigs, account_id_type account,
+                           bool allow_non_immediate_owner, uint32_t max_recursion, result&& r );
+
+      void   clear() { _results.clear(); }
+      size_t size()const { return _results.size(); }
+
+      /// The cache is cleared when it grows beyond this number of results
+      static constexpr size_t max_size = 10000;
+
+   private:
+      using key_type = std::tuple< flat_set<public_key_type>, account_id_type, bool, uint32_t >;
+      map< key_type, result > _results;
    };
 
    /**
@@ -264,6 +341,8 @@ namespace graphene { namespace protocol {
     * @param allow_committee whether to allow the special "committee account" to authorize the operations
     * @param active_approvals accounts that approved the operations with their active authories
     * @param owner_approvals accounts that approved the operations with their owner authories
+    * @param cache if not null, used to look up and store whether the active authorities of the required accounts
+    *            are satisfied by @p sigs
     */
    void verify_authority( const vector<operation>& ops, const flat_set<public_key_type>& sigs,
                           const std::function<const authority*(account_id_type)>& get_active,
@@ -274,7 +353,8 @@ namespace graphene { namespace protocol {
                           uint32_t max_recursion = GRAPHENE_MAX_SIG_CHECK_DEPTH,
                           bool allow_committee = false,
                           const flat_set<account_id_type>& active_approvals = flat_set<account_id_type>(),
-                          const flat_set<account_id_type>& owner_approvals = flat_set<account_id_type>() );
+                          const flat_set<account_id_type>& owner_approvals = flat_set<account_id_type>(),
+                          authority_satisfaction_cache* cache = nullptr );
 
    /**
     *  @brief captures the result of evaluating the operations contained in the transaction
@@ -293,13 +373,41 @@ namespace graphene { namespace protocol {
    {
       processed_transaction( const signed_transaction& trx = signed_transaction() )
          : precomputable_transaction(trx){}
+      /// Copies do not take over the cached merkle digest, so that their results can be changed
+      processed_transaction( const processed_transaction& trx )
+         : precomputable_transaction(trx), operation_results(trx.operation_results){}
+      processed_transaction( processed_transaction&& trx ) = default;
       virtual ~processed_transaction() = default;
 
+      processed_transaction& operator=( const processed_transaction& trx );
+      processed_transaction& operator=( processed_transaction&& trx ) = default;
+
       vector<operation_result> operation_results;
 
-      digest_type merkle_digest()const;
+      /**
+       * Digest of the packed transaction including results, cached after the first call.
+       * @ref operation_results must not be changed afterwards, unless @ref set_operation_results is used.
+       */
+      const digest_type& merkle_digest()const;
+
+      /// Replace the results and drop the cached merkle digest
+      void set_operation_results( vector<operation_result>&& results );
+
+      /// Unpack the transaction from its wire bytes, see @ref precomputable_transaction::unpack_from_wire
+      void unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer, fc::datastream<const char*>& ds );
+   protected:
+      mutable optional<digest_type> _merkle_digest;
    };
 
+   /**
+    * @brief Throw unless the bytes from @p begin to @p end are exactly @p packed
+    *
+    * fc accepts non-canonical encodings, e.g. over-long varints or unsorted flat containers, and unpacks them to
+    * the same values as the canonical encoding. Values derived from wire bytes must only be trusted if the bytes
+    * are the canonical encoding, i.e. the repacked value.
+    */
+   void check_canonical_encoding( const vector<char>& packed, const char* begin, const char* end );
+
    /// @} transactions group
 
 } } // graphene::protocol
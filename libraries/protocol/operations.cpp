@@ -100,6 +100,47 @@ void operation_validate( const operation& op )
    op.visit( operation_validator() );
 }
 
+bool operation_has_expensive_validation( const operation& op )
+{
+   switch( op.which() )
+   {
+   case operation::tag<transfer_to_blind_operation>::value:
+   case operation::tag<transfer_from_blind_operation>::value:
+   case operation::tag<blind_transfer_operation>::value:
+      return true;
+   default:
+      return false;
+   }
+}
+
+struct operation_name_visitor
+{
+   using result_type = std::string;
+
+   template<typename T>
+   std::string operator()( const T& )const
+   {
+      const std::string name = fc::get_typename<T>::name();
+      return name.substr( name.rfind( ':' ) + 1 );
+   }
+};
+
+const std::string& operation_name( int64_t which )
+{
+   static const std::vector<std::string> names = []() {
+      std::vector<std::string> result;
+      operation op;
+      for( int64_t i = 0; i < operation::count(); ++i )
+      {
+         op.set_which( i );
+         result.push_back( op.visit( operation_name_visitor() ) );
+      }
+      return result;
+   }();
+   FC_ASSERT( which >= 0 && which < int64_t( names.size() ), "Invalid operation type ${w}", ("w",which) );
+   return names[ which ];
+}
+
 void operation_get_required_authorities( const operation& op,
                                          flat_set<account_id_type>& active,
                                          flat_set<account_id_type>& owner,
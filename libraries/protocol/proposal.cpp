@@ -43,9 +43,11 @@ void proposal_create_operation::validate() const
    for( const auto& op : proposed_ops ) operation_validate( op.op );
 }
 
-share_type proposal_create_operation::calculate_fee(const fee_params_t& k) const
+share_type proposal_create_operation::calculate_fee( const fee_params_t& k,
+                                                     const optional<uint64_t>& packed_size )const
 {
-   return k.fee + calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte );
+   return k.fee + calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                      k.price_per_kbyte );
 }
 
 void proposal_update_operation::validate() const
@@ -76,9 +78,11 @@ void proposal_delete_operation::validate() const
    FC_ASSERT( fee.amount >= 0 );
 }
 
-share_type proposal_update_operation::calculate_fee(const fee_params_t& k) const
+share_type proposal_update_operation::calculate_fee( const fee_params_t& k,
+                                                     const optional<uint64_t>& packed_size )const
 {
-   return k.fee + calculate_data_fee( fc::raw::pack_size(*this), k.price_per_kbyte );
+   return k.fee + calculate_data_fee( packed_size.valid() ? *packed_size : fc::raw::pack_size(*this),
+                                      k.price_per_kbyte );
 }
 
 void proposal_update_operation::get_required_authorities( vector<authority>& o )const
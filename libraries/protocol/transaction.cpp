@@ -33,11 +33,47 @@
 
 namespace graphene { namespace protocol {
 
-digest_type processed_transaction::merkle_digest()const
+const digest_type& processed_transaction::merkle_digest()const
 {
-   digest_type::encoder enc;
-   fc::raw::pack( enc, *this );
-   return enc.result();
+   if( !_merkle_digest.valid() )
+   {
+      digest_type::encoder enc;
+      fc::raw::pack( enc, *this );
+      _merkle_digest = enc.result();
+   }
+   return *_merkle_digest;
+}
+
+processed_transaction& processed_transaction::operator=( const processed_transaction& trx )
+{
+   precomputable_transaction::operator=( trx );
+   operation_results = trx.operation_results;
+   _merkle_digest.reset();
+   return *this;
+}
+
+void processed_transaction::set_operation_results( vector<operation_result>&& results )
+{
+   operation_results = std::move( results );
+   _merkle_digest.reset();
+}
+
+void processed_transaction::unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer,
+                                              fc::datastream<const char*>& ds )
+{
+   const char* const begin = ds.pos();
+   precomputable_transaction::unpack_from_wire( buffer, ds );
+   // the transaction itself is checked by the base class, the merkle digest also covers the rest
+   const char* const results_begin = ds.pos();
+   fc::raw::unpack( ds, operation_results );
+   check_canonical_encoding( fc::raw::pack( operation_results ), results_begin, ds.pos() );
+   _merkle_digest = digest_type::hash( begin, ds.pos() - begin );
+}
+
+void check_canonical_encoding( const vector<char>& packed, const char* begin, const char* end )
+{
+   FC_ASSERT( packed.size() == size_t( end - begin ) && std::equal( packed.begin(), packed.end(), begin ),
+              "Non-canonical encoding" );
 }
 
 digest_type transaction::digest()const
@@ -67,6 +103,21 @@ uint64_t transaction::get_packed_size() const
    return fc::raw::pack_size(*this);
 }
 
+namespace {
+   struct operation_packed_size_visitor
+   {
+      using result_type = uint64_t;
+      template<typename Operation>
+      uint64_t operator()( const Operation& op )const { return fc::raw::pack_size( op ); }
+   };
+}
+
+uint64_t transaction::get_operation_packed_size( size_t op_index )const
+{
+   FC_ASSERT( op_index < operations.size() );
+   return operations[op_index].visit( operation_packed_size_visitor() );
+}
+
 const transaction_id_type& transaction::id() const
 {
    auto h = digest();
@@ -135,24 +186,19 @@ struct sign_state
       optional<map<address,public_key_type>> available_address_sigs;
       optional<map<address,public_key_type>> provided_address_sigs;
 
+      /// Only called for authorities with address_auths, so keys are not derived to addresses otherwise
       bool signed_by( const address& a ) {
          if( !available_address_sigs ) {
-            available_address_sigs = std::map<address,public_key_type>();
-            provided_address_sigs = std::map<address,public_key_type>();
-            for( auto& item : available_keys ) {
-             (*available_address_sigs)[ address(pts_address(item, false) ) ] = item; // verison = 56 (default)
-             (*available_address_sigs)[ address(pts_address(item, true) ) ] = item; // verison = 56 (default)
-             (*available_address_sigs)[ address(pts_address(item, false, 0) ) ] = item;
-             (*available_address_sigs)[ address(pts_address(item, true, 0) ) ] = item;
-             (*available_address_sigs)[ address(item) ] = item;
-            }
-            for( auto& item : provided_signatures ) {
-             (*provided_address_sigs)[ address(pts_address(item.first, false) ) ] = item.first; //verison 56 (default)
-             (*provided_address_sigs)[ address(pts_address(item.first, true) ) ] = item.first; // verison 56 (default)
-             (*provided_address_sigs)[ address(pts_address(item.first, false, 0) ) ] = item.first;
-             (*provided_address_sigs)[ address(pts_address(item.first, true, 0) ) ] = item.first;
-             (*provided_address_sigs)[ address(item.first) ] = item.first;
-            }
+            auto add_key_addresses = []( map<address,public_key_type>& sigs, const public_key_type& key ) {
+               for( const address& addr : get_key_addresses( key ) )
+                  sigs[ addr ] = key;
+            };
+            available_address_sigs = map<address,public_key_type>();
+            provided_address_sigs = map<address,public_key_type>();
+            for( auto& item : available_keys )
+               add_key_addresses( *available_address_sigs, item );
+            for( auto& item : provided_signatures )
+               add_key_addresses( *provided_address_sigs, item.first );
          }
          auto itr = provided_address_sigs->find(a);
          if( itr == provided_address_sigs->end() )
@@ -162,8 +208,8 @@ struct sign_state
                auto pk = available_keys.find(aitr->second);
                if( pk != available_keys.end() )
                   return provided_signatures[aitr->second] = true;
-               return false;
             }
+            return false;
          }
          return provided_signatures[itr->second] = true;
       }
@@ -275,7 +321,8 @@ void verify_authority( const vector<operation>& ops, const flat_set<public_key_t
                        uint32_t max_recursion_depth,
                        bool  allow_committee,
                        const flat_set<account_id_type>& active_aprovals,
-                       const flat_set<account_id_type>& owner_approvals )
+                       const flat_set<account_id_type>& owner_approvals,
+                       authority_satisfaction_cache* cache )
 {
    rejected_predicate_map rejected_custom_auths;
    try {
@@ -331,10 +378,33 @@ void verify_authority( const vector<operation>& ops, const flat_set<public_key_t
                        tx_missing_owner_auth, "Missing Owner Authority ${id}", ("id",id)("auth",*get_owner(id)) );
    }
 
+   auto check_active_or_owner = [&]( account_id_type id ) {
+      // The walk only depends on the keys and on the accounts approved so far, so a cached result is only
+      // identical when no account is approved yet, i.e. when approved_by only contains the temp account
+      if( cache == nullptr || s.approved_by.size() != 1 )
+         return s.check_authority(id) || s.check_authority(get_owner(id));
+
+      const auto* cached = cache->find( sigs, id, allow_non_immediate_owner, max_recursion_depth );
+      if( cached == nullptr )
+      {
+         sign_state fresh( sigs, get_active, get_owner, allow_non_immediate_owner, max_recursion_depth );
+         authority_satisfaction_cache::result r;
+         r.satisfied = fresh.check_authority(id) || fresh.check_authority(get_owner(id));
+         for( const auto& sig : fresh.provided_signatures )
+            if( sig.second )
+               r.used_keys.insert( sig.first );
+         r.approved = std::move( fresh.approved_by );
+         cached = &cache->store( sigs, id, allow_non_immediate_owner, max_recursion_depth, std::move(r) );
+      }
+      for( const auto& key : cached->used_keys )
+         s.provided_signatures[key] = true;
+      s.approved_by.insert( cached->approved.begin(), cached->approved.end() );
+      return cached->satisfied;
+   };
+
    for( auto id : required_active )
    {
-      GRAPHENE_ASSERT( s.check_authority(id) ||
-                       s.check_authority(get_owner(id)),
+      GRAPHENE_ASSERT( check_active_or_owner(id),
                        tx_missing_active_auth, "Missing Active Authority ${id}",
                        ("id",id)("auth",*get_active(id))("owner",*get_owner(id)) );
    }
@@ -349,7 +419,11 @@ void verify_authority( const vector<operation>& ops, const flat_set<public_key_t
 
 const flat_set<public_key_type>& signed_transaction::get_signature_keys( const chain_id_type& chain_id )const
 { try {
-   auto d = sig_digest( chain_id );
+   return extract_signature_keys( sig_digest( chain_id ) );
+} FC_CAPTURE_AND_RETHROW() }
+
+const flat_set<public_key_type>& signed_transaction::extract_signature_keys( const digest_type& d )const
+{
    flat_set<public_key_type> result;
    for( const auto&  sig : signatures )
    {
@@ -360,7 +434,7 @@ const flat_set<public_key_type>& signed_transaction::get_signature_keys( const c
    }
    _signees = std::move( result );
    return _signees;
-} FC_CAPTURE_AND_RETHROW() }
+}
 
 
 set<public_key_type> signed_transaction::get_required_signatures( const chain_id_type& chain_id,
@@ -445,6 +519,22 @@ void precomputable_transaction::validate() const
    _validated = true;
 }
 
+void precomputable_transaction::validate_except_expensive_operations()const
+{
+   if( _validated ) return;
+   FC_ASSERT( operations.size() > 0, "A transaction must have at least one operation", ("trx",*this) );
+   bool skipped = false;
+   for( const auto& op : operations )
+   {
+      if( operation_has_expensive_validation( op ) )
+         skipped = true;
+      else
+         operation_validate( op );
+   }
+   if( !skipped )
+      _validated = true;
+}
+
 uint64_t precomputable_transaction::get_packed_size()const
 {
    if( _packed_size == 0 )
@@ -452,28 +542,97 @@ uint64_t precomputable_transaction::get_packed_size()const
    return _packed_size;
 }
 
+uint64_t precomputable_transaction::get_operation_packed_size( size_t op_index )const
+{
+   if( _operation_packed_sizes.size() != operations.size() )
+   {
+      _operation_packed_sizes.clear();
+      _operation_packed_sizes.reserve( operations.size() );
+      for( size_t i = 0; i < operations.size(); ++i )
+         _operation_packed_sizes.push_back( transaction::get_operation_packed_size( i ) );
+   }
+   FC_ASSERT( op_index < _operation_packed_sizes.size() );
+   return _operation_packed_sizes[op_index];
+}
+
 const flat_set<public_key_type>& precomputable_transaction::get_signature_keys( const chain_id_type& chain_id )const
 {
    // Strictly we should check whether the given chain ID is same as the one used to initialize the `signees` field.
    // However, we don't pass in another chain ID so far, for better performance, we skip the check.
    if( _signees.empty() )
-      signed_transaction::get_signature_keys( chain_id );
+   {
+      if( _wire_buffer )
+      { try {
+         digest_type::encoder enc;
+         fc::raw::pack( enc, chain_id );
+         enc.write( _wire_trx, _packed_size );
+         extract_signature_keys( enc.result() );
+         // the wire bytes are not needed anymore
+         _wire_buffer.reset();
+         _wire_trx = nullptr;
+      } FC_CAPTURE_AND_RETHROW() }
+      else
+         signed_transaction::get_signature_keys( chain_id );
+   }
    return _signees;
 }
 
+void precomputable_transaction::unpack_from_wire( const std::shared_ptr<const vector<char>>& buffer,
+                                                  fc::datastream<const char*>& ds )
+{
+   FC_ASSERT( buffer && ds.pos() >= buffer->data() && ds.pos() <= buffer->data() + buffer->size(),
+              "The stream does not read from the buffer" );
+   const char* const begin = ds.pos();
+   fc::raw::unpack( ds, static_cast<transaction&>(*this) );
+   const char* const end = ds.pos();
+   check_canonical_encoding( fc::raw::pack( static_cast<const transaction&>(*this) ), begin, end );
+   fc::raw::unpack( ds, signatures );
+   check_canonical_encoding( fc::raw::pack( signatures ), end, ds.pos() );
+
+   _validated = false;
+   _signees.clear();
+   _packed_size = end - begin;
+   auto h = digest_type::hash( begin, end - begin );
+   memcpy(_tx_id_buffer._hash, h._hash, std::min(sizeof(_tx_id_buffer), sizeof(h)));
+   _wire_buffer = buffer;
+   _wire_trx = begin;
+}
+
 void signed_transaction::verify_authority( const chain_id_type& chain_id,
                                            const std::function<const authority*(account_id_type)>& get_active,
                                            const std::function<const authority*(account_id_type)>& get_owner,
                                            const custom_authority_lookup& get_custom,
                                            bool allow_non_immediate_owner,
                                            bool ignore_custom_operation_required_auths,
-                                           uint32_t max_recursion )const
+                                           uint32_t max_recursion,
+                                           authority_satisfaction_cache* cache )const
 { try {
    graphene::protocol::verify_authority( operations, get_signature_keys( chain_id ), get_active, get_owner,
                                          get_custom, allow_non_immediate_owner,
-                                         ignore_custom_operation_required_auths, max_recursion );
+                                         ignore_custom_operation_required_auths, max_recursion,
+                                         false, flat_set<account_id_type>(), flat_set<account_id_type>(), cache );
 } FC_CAPTURE_AND_RETHROW( (*this) ) }
 
+const authority_satisfaction_cache::result* authority_satisfaction_cache::find(
+      const flat_set<public_key_type>& sigs, account_id_type account,
+      bool allow_non_immediate_owner, uint32_t max_recursion )const
+{
+   auto itr = _results.find( std::make_tuple( sigs, account, allow_non_immediate_owner, max_recursion ) );
+   if( itr == _results.end() )
+      return nullptr;
+   return &itr->second;
+}
+
+const authority_satisfaction_cache::result& authority_satisfaction_cache::store(
+      const flat_set<public_key_type>& sigs, account_id_type account,
+      bool allow_non_immediate_owner, uint32_t max_recursion, result&& r )
+{
+   if( _results.size() >= max_size )
+      _results.clear();
+   auto key = std::make_tuple( sigs, account, allow_non_immediate_owner, max_recursion );
+   return _results[ std::move(key) ] = std::move(r);
+}
+
 } } // graphene::protocol
 
 GRAPHENE_IMPLEMENT_EXTERNAL_SERIALIZATION( graphene::protocol::transaction)
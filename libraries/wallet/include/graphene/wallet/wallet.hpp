@@ -1660,6 +1660,24 @@ class wallet_api
                                             const vector<public_key_type>& signing_keys = vector<public_key_type>(),
                                             bool broadcast = true )const;
 
+      /** Sets fees on and signs many transactions at once.
+       *
+       * Given fully-formed transactions that are only lacking fees and signatures, this sets the
+       * fees of all operations, looks up the keys required by all transactions with one request to
+       * the server per batch of the size the server allows, signs the transactions on several threads,
+       * and optionally broadcasts them with at most @p max_in_flight broadcasts awaiting a reply at any time.
+       * A rejected transaction does not stop the others from being broadcast, its error is returned instead.
+       * @param txs the transactions to be signed
+       * @param fee_asset the symbol or ID of the asset to pay the fees in
+       * @param max_in_flight the maximum number of unanswered broadcasts, 0 for the default of 50
+       * @param broadcast true if you wish to broadcast the transactions
+       * @return the signed versions of the transactions and the outcomes of their broadcasts, in the given order
+       */
+      vector<signed_transaction_result> sign_transactions( const vector<signed_transaction>& txs,
+                                                           const string& fee_asset = GRAPHENE_SYMBOL,
+                                                           uint32_t max_in_flight = 0,
+                                                           bool broadcast = false )const;
+
 
       /** Get transaction signers.
        *
@@ -1934,6 +1952,7 @@ FC_API( graphene::wallet::wallet_api,
         (serialize_transaction)
         (sign_transaction)
         (sign_transaction2)
+        (sign_transactions)
         (add_transaction_signature)
         (get_transaction_signers)
         (get_key_references)
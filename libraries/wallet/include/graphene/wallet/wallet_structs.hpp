@@ -319,6 +319,13 @@ struct account_history_operation_detail {
    vector<operation_detail_ex>  details;
 };
 
+/// A transaction signed by @ref wallet_api::sign_transactions and the outcome of its broadcast
+struct signed_transaction_result {
+   signed_transaction   transaction;
+   bool                 accepted = false; ///< true if the transaction was broadcast and accepted by the server
+   fc::optional<string> error;            ///< the reason the server rejected the transaction, if it did
+};
+
 }} // namespace graphene::wallet
 
 FC_REFLECT( graphene::wallet::key_label, (label)(key) )
@@ -385,5 +392,6 @@ FC_REFLECT(graphene::wallet::operation_detail_ex,
 FC_REFLECT( graphene::wallet::account_history_operation_detail,
         (total_count)(result_count)(details))
 
+FC_REFLECT( graphene::wallet::signed_transaction_result, (transaction)(accepted)(error) )
 FC_REFLECT( graphene::wallet::signed_message_meta, (account)(memo_key)(block)(time) )
 FC_REFLECT( graphene::wallet::signed_message, (message)(meta)(signature) )
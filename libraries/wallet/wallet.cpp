@@ -1026,6 +1026,14 @@ signed_transaction wallet_api::sign_transaction2( const signed_transaction& tx,
    return my->sign_transaction2( tx, signing_keys, broadcast);
 } FC_CAPTURE_AND_RETHROW( (tx) ) }
 
+vector<signed_transaction_result> wallet_api::sign_transactions( const vector<signed_transaction>& txs,
+                                                                 const string& fee_asset,
+                                                                 uint32_t max_in_flight,
+                                                                 bool broadcast /* = false */ )const
+{ try {
+   return my->sign_transactions( txs, fee_asset, max_in_flight, broadcast );
+} FC_CAPTURE_AND_RETHROW( (fee_asset)(max_in_flight)(broadcast) ) }
+
 flat_set<public_key_type> wallet_api::get_transaction_signers( const signed_transaction& tx ) const
 { try {
    return my->get_transaction_signers(tx);
@@ -333,6 +333,8 @@ public:
    signed_transaction sign_transaction2(signed_transaction tx,
                                         const vector<public_key_type>& signing_keys = vector<public_key_type>(),
                                         bool broadcast = false);
+   vector<signed_transaction_result> sign_transactions( vector<signed_transaction> txs, const string& fee_asset,
+                                                        uint32_t max_in_flight, bool broadcast );
 
    flat_set<public_key_type> get_transaction_signers(const signed_transaction &tx) const;
 
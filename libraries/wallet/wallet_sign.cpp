@@ -23,6 +23,9 @@
  */
 
 #include <fc/crypto/aes.hpp>
+#include <fc/thread/parallel.hpp>
+
+#include <deque>
 
 #include "wallet_api_impl.hpp"
 #include <graphene/wallet/wallet.hpp>
@@ -397,6 +400,159 @@ namespace graphene { namespace wallet { namespace detail {
       return tx;
    }
 
+   vector<signed_transaction_result> wallet_api_impl::sign_transactions( vector<signed_transaction> txs,
+         const string& fee_asset, uint32_t max_in_flight, bool broadcast )
+   {
+      // Used when the server does not tell its limit of transactions per signature lookup
+      static constexpr size_t default_lookup_batch_size = 1000;
+      static constexpr uint32_t default_max_in_flight = 50;
+
+      vector<signed_transaction_result> results;
+      if( txs.empty() )
+         return results;
+
+      // Fees: one request for the fee schedule and one for the fee asset, whatever the number of transactions
+      const auto fee_asset_obj = get_asset( fee_asset );
+      const auto fees = _remote_db->get_global_properties().parameters.get_current_fees();
+      for( auto& tx : txs )
+      {
+         for( auto& op : tx.operations )
+         {
+            if( fee_asset_obj.get_id() == asset_id_type() )
+               fees.set_fee( op );
+            else
+               fees.set_fee( op, fee_asset_obj.options.core_exchange_rate );
+         }
+         tx.clear_signatures();
+         tx.validate();
+      }
+
+      // Keys: potential and then required signatures of whole batches, decoding each owned key only once.
+      // The batches are as large as the server allows, and halved whenever the server rejects one anyway.
+      size_t lookup_batch_size = default_lookup_batch_size;
+      try
+      {
+         lookup_batch_size = std::max<uint32_t>( 1, _remote_api->get_config().api_limit_get_signatures_batch );
+      }
+      catch( const fc::exception& e )
+      {
+         wlog( "Unable to get the limits of the server, looking up signatures of ${n} transactions at once: ${e}",
+               ("n", lookup_batch_size)("e", e.to_string()) );
+      }
+      vector<set<public_key_type>> required_keys;
+      required_keys.reserve( txs.size() );
+      map<public_key_type, fc::ecc::private_key> signing_keys;
+      for( size_t base = 0; base < txs.size(); )
+      {
+         const vector<signed_transaction> batch( txs.begin() + base,
+                                                 txs.begin() + std::min( base + lookup_batch_size, txs.size() ) );
+         vector<set<public_key_type>> batch_keys;
+         try
+         {
+            flat_set<public_key_type> owned_keys;
+            for( const auto& potential : _remote_db->get_potential_signatures_batch( batch ) )
+               for( const auto& key : potential )
+                  if( _keys.find( key ) != _keys.end() )
+                     owned_keys.insert( key );
+            batch_keys = _remote_db->get_required_signatures_batch( batch, owned_keys );
+         }
+         catch( const fc::exception& e )
+         {
+            if( batch.size() <= 1 )
+               throw;
+            lookup_batch_size = batch.size() / 2;
+            wlog( "Signature lookup of ${n} transactions rejected, retrying with ${m}: ${e}",
+                  ("n", batch.size())("m", lookup_batch_size)("e", e.to_string()) );
+            continue;
+         }
+         FC_ASSERT( batch_keys.size() == batch.size(), "Unexpected number of results from the server" );
+         for( auto& keys : batch_keys )
+         {
+            for( const auto& key : keys )
+               if( signing_keys.find( key ) == signing_keys.end() )
+                  signing_keys.emplace( key, get_private_key( key ) );
+            required_keys.push_back( std::move( keys ) );
+         }
+         base += batch.size();
+      }
+
+      // Make every transaction unique as sign_transaction2 does. The ID does not cover the signatures,
+      // so this is done before signing and each transaction is signed only once.
+      auto dyn_props = get_dynamic_global_properties();
+      fc::time_point_sec oldest_transaction_ids_to_track(dyn_props.time - fc::minutes(2));
+      auto& by_time = _recently_generated_transactions.get<timestamp_index>();
+      by_time.erase( by_time.begin(), by_time.lower_bound( oldest_transaction_ids_to_track ) );
+      for( auto& tx : txs )
+      {
+         tx.set_reference_block( dyn_props.head_block_id );
+         for( uint32_t expiration_time_offset = 0; ; ++expiration_time_offset )
+         {
+            tx.set_expiration( dyn_props.time + fc::seconds(30 + expiration_time_offset) );
+            recently_generated_transaction_record this_transaction_record;
+            this_transaction_record.generation_time = dyn_props.time;
+            this_transaction_record.transaction_id = tx.id();
+            if( _recently_generated_transactions.insert( this_transaction_record ).second )
+               break;
+         }
+      }
+
+      // Signatures: contiguous chunks of transactions on the thread pool
+      {
+         const size_t chunks = fc::asio::default_io_service_scope::get_num_threads();
+         const size_t chunk_size = ( txs.size() + chunks - 1 ) / chunks;
+         std::vector<fc::future<void>> workers;
+         for( size_t base = 0; base < txs.size(); base += chunk_size )
+            workers.push_back( fc::do_parallel( [this,&txs,&required_keys,&signing_keys,base,chunk_size] () {
+               const size_t end = std::min( base + chunk_size, txs.size() );
+               for( size_t i = base; i < end; ++i )
+                  for( const public_key_type& key : required_keys[i] )
+                     txs[i].sign( signing_keys.at( key ), _chain_id );
+            }) );
+         for( auto& worker : workers )
+            worker.wait();
+      }
+
+      results.resize( txs.size() );
+      for( size_t i = 0; i < txs.size(); ++i )
+         results[i].transaction = std::move( txs[i] );
+
+      // Broadcast: every transaction is sent, a rejected one is reported in its result
+      if( broadcast )
+      {
+         if( 0 == max_in_flight )
+            max_in_flight = default_max_in_flight;
+         std::deque<fc::future<void>> in_flight;
+         size_t oldest = 0;
+         auto wait_oldest = [&in_flight,&oldest,&results] () {
+            try
+            {
+               in_flight.front().wait();
+               results[oldest].accepted = true;
+            }
+            catch( const fc::exception& e )
+            {
+               elog("Caught exception while broadcasting tx ${id}:  ${e}",
+                    ("id", results[oldest].transaction.id().str())("e", e.to_detail_string()) );
+               results[oldest].error = e.to_string();
+            }
+            in_flight.pop_front();
+            ++oldest;
+         };
+         for( size_t i = 0; i < results.size(); ++i )
+         {
+            if( in_flight.size() >= max_in_flight )
+               wait_oldest();
+            in_flight.push_back( fc::async( [this,&tx = results[i].transaction] () {
+               _remote_net_broadcast->broadcast_transaction( tx );
+            }, "Broadcast transaction" ) );
+         }
+         while( !in_flight.empty() )
+            wait_oldest();
+      }
+
+      return results;
+   }
+
    fc::ecc::private_key wallet_api_impl::get_private_key(const public_key_type& id)const
    {
       auto it = _keys.find(id);
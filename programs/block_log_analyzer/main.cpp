@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <graphene/chain/block_database.hpp>
+
+#include <fc/io/json.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/variant_object.hpp>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+using namespace graphene::chain;
+namespace bpo = boost::program_options;
+
+namespace {
+
+/**
+ * A statistic over a range of blocks. Each scanning thread fills its own instance, the instances are merged
+ * at the end. To add a statistic, derive from this class and register it in @ref make_accumulators.
+ */
+class accumulator
+{
+   public:
+      virtual ~accumulator() = default;
+
+      /// An empty accumulator of the same statistic
+      virtual std::unique_ptr<accumulator> clone_empty()const = 0;
+      virtual void add_block( const signed_block& block ) = 0;
+      /// Adds the results of @p other, which is of the same type as this
+      virtual void merge( const accumulator& other ) = 0;
+      /// Results, listing at most @p top entries in rankings
+      virtual fc::variant result( uint32_t top )const = 0;
+};
+
+struct fee_payer_visitor
+{
+   using result_type = account_id_type;
+
+   template<typename T>
+   account_id_type operator()( const T& op )const { return op.fee_payer(); }
+};
+
+struct fee_visitor
+{
+   using result_type = asset;
+
+   template<typename T>
+   asset operator()( const T& op )const { return op.fee; }
+};
+
+/// Number of blocks, transactions and operations, and operations by type
+class operation_counts : public accumulator
+{
+   public:
+      operation_counts() : _counts( operation::count() ) {}
+
+      std::unique_ptr<accumulator> clone_empty()const override { return std::make_unique<operation_counts>(); }
+
+      void add_block( const signed_block& block ) override
+      {
+         ++_blocks;
+         _transactions += block.transactions.size();
+         for( const auto& trx : block.transactions )
+            for( const auto& op : trx.operations )
+               ++_counts[ op.which() ];
+      }
+
+      void merge( const accumulator& other ) override
+      {
+         const auto& o = static_cast<const operation_counts&>( other );
+         _blocks += o._blocks;
+         _transactions += o._transactions;
+         for( size_t i = 0; i < _counts.size(); ++i )
+            _counts[i] += o._counts[i];
+      }
+
+      fc::variant result( uint32_t )const override
+      {
+         fc::mutable_variant_object by_type;
+         uint64_t total = 0;
+         for( size_t i = 0; i < _counts.size(); ++i )
+         {
+            total += _counts[i];
+            if( _counts[i] == 0 )
+               continue;
+            by_type( operation_name( i ), _counts[i] );
+         }
+         return fc::mutable_variant_object( "blocks", _blocks )
+                                          ( "transactions", _transactions )
+                                          ( "operations", total )
+                                          ( "by_type", by_type );
+      }
+
+   private:
+      uint64_t              _blocks = 0;
+      uint64_t              _transactions = 0;
+      std::vector<uint64_t> _counts;
+};
+
+/// Operations by fee paying account
+class account_activity : public accumulator
+{
+   public:
+      std::unique_ptr<accumulator> clone_empty()const override { return std::make_unique<account_activity>(); }
+
+      void add_block( const signed_block& block ) override
+      {
+         fee_payer_visitor payer_visitor;
+         for( const auto& trx : block.transactions )
+            for( const auto& op : trx.operations )
+               ++_operations[ op.visit( payer_visitor ).instance.value ];
+      }
+
+      void merge( const accumulator& other ) override
+      {
+         for( const auto& item : static_cast<const account_activity&>( other )._operations )
+            _operations[ item.first ] += item.second;
+      }
+
+      fc::variant result( uint32_t top )const override
+      {
+         std::vector<std::pair<uint64_t, uint64_t>> ranking( _operations.begin(), _operations.end() );
+         const size_t n = std::min<size_t>( top, ranking.size() );
+         std::partial_sort( ranking.begin(), ranking.begin() + n, ranking.end(),
+                            []( const std::pair<uint64_t, uint64_t>& a, const std::pair<uint64_t, uint64_t>& b ) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+         });
+         fc::variants top_accounts;
+         for( size_t i = 0; i < n; ++i )
+            top_accounts.emplace_back( fc::mutable_variant_object( "account", account_id_type( ranking[i].first ) )
+                                                                 ( "operations", ranking[i].second ) );
+         return fc::mutable_variant_object( "active_accounts", _operations.size() )
+                                          ( "top", top_accounts );
+      }
+
+   private:
+      std::unordered_map<uint64_t, uint64_t> _operations;
+};
+
+/// Distribution of packed transaction sizes, in power-of-two buckets
+class transaction_sizes : public accumulator
+{
+   public:
+      transaction_sizes() : _buckets( 33 ) {}
+
+      std::unique_ptr<accumulator> clone_empty()const override { return std::make_unique<transaction_sizes>(); }
+
+      void add_block( const signed_block& block ) override
+      {
+         for( const auto& trx : block.transactions )
+         {
+            const uint64_t size = fc::raw::pack_size( static_cast<const signed_transaction&>( trx ) );
+            ++_count;
+            _total += size;
+            _max = std::max( _max, size );
+            size_t bucket = 0;
+            while( bucket + 1 < _buckets.size() && ( uint64_t(1) << bucket ) < size )
+               ++bucket;
+            ++_buckets[ bucket ];
+         }
+      }
+
+      void merge( const accumulator& other ) override
+      {
+         const auto& o = static_cast<const transaction_sizes&>( other );
+         _count += o._count;
+         _total += o._total;
+         _max = std::max( _max, o._max );
+         for( size_t i = 0; i < _buckets.size(); ++i )
+            _buckets[i] += o._buckets[i];
+      }
+
+      fc::variant result( uint32_t )const override
+      {
+         fc::mutable_variant_object histogram;
+         for( size_t i = 0; i < _buckets.size(); ++i )
+            if( _buckets[i] > 0 )
+               histogram( "<=" + std::to_string( uint64_t(1) << i ), _buckets[i] );
+         return fc::mutable_variant_object( "transactions", _count )
+                                          ( "total_bytes", _total )
+                                          ( "mean_bytes", _count > 0 ? double( _total ) / _count : 0.0 )
+                                          ( "max_bytes", _max )
+                                          ( "histogram", histogram );
+      }
+
+   private:
+      uint64_t              _count = 0;
+      uint64_t              _total = 0;
+      uint64_t              _max = 0;
+      std::vector<uint64_t> _buckets;
+};
+
+/// Fees declared by operations, by fee asset
+class fee_totals : public accumulator
+{
+   public:
+      std::unique_ptr<accumulator> clone_empty()const override { return std::make_unique<fee_totals>(); }
+
+      void add_block( const signed_block& block ) override
+      {
+         fee_visitor visitor;
+         for( const auto& trx : block.transactions )
+            for( const auto& op : trx.operations )
+            {
+               const asset fee = op.visit( visitor );
+               _fees[ fee.asset_id ] += fee.amount;
+            }
+      }
+
+      void merge( const accumulator& other ) override
+      {
+         for( const auto& item : static_cast<const fee_totals&>( other )._fees )
+            _fees[ item.first ] += item.second;
+      }
+
+      fc::variant result( uint32_t )const override
+      {
+         fc::variants fees;
+         for( const auto& item : _fees )
+            fees.emplace_back( fc::mutable_variant_object( "asset_id", item.first )( "amount", item.second ) );
+         return fees;
+      }
+
+   private:
+      std::map<asset_id_type, share_type> _fees;
+};
+
+using accumulator_set = std::vector<std::pair<std::string, std::unique_ptr<accumulator>>>;
+
+/// Creates the accumulators of the named statistics, or of all statistics if @p names is empty
+accumulator_set make_accumulators( const std::vector<std::string>& names )
+{
+   accumulator_set all;
+   all.emplace_back( "operation_counts", std::make_unique<operation_counts>() );
+   all.emplace_back( "account_activity", std::make_unique<account_activity>() );
+   all.emplace_back( "transaction_sizes", std::make_unique<transaction_sizes>() );
+   all.emplace_back( "fee_totals", std::make_unique<fee_totals>() );
+   if( names.empty() )
+      return all;
+
+   accumulator_set selected;
+   for( const auto& name : names )
+   {
+      auto itr = std::find_if( all.begin(), all.end(), [&name]( const auto& a ) { return a.first == name; } );
+      FC_ASSERT( itr != all.end(), "Unknown statistic ${s}", ("s", name) );
+      selected.emplace_back( name, itr->second->clone_empty() );
+   }
+   return selected;
+}
+
+} // anonymous namespace
+
+int main( int argc, char** argv )
+{
+   try {
+      bpo::options_description opts;
+      opts.add_options()
+         ("help,h", "Print this help message and exit.")
+         ("data-dir,d", bpo::value<boost::filesystem::path>()->default_value("witness_node_data_dir"),
+               "Directory of a witness node, whose block log is analyzed")
+         ("block-log-dir", bpo::value<boost::filesystem::path>(),
+               "Directory of the block log, overrides data-dir")
+         ("first-block", bpo::value<uint32_t>()->default_value(1), "First block to analyze")
+         ("last-block", bpo::value<uint32_t>()->default_value(0), "Last block to analyze, 0 for the last stored block")
+         ("threads,t", bpo::value<uint32_t>()->default_value(std::max(1u, std::thread::hardware_concurrency())),
+               "Number of threads decoding blocks")
+         ("chunk-size", bpo::value<uint32_t>()->default_value(1000),
+               "Number of consecutive blocks a thread takes at a time")
+         ("statistics,s", bpo::value<string>()->default_value(""),
+               "Comma separated statistics to compute, default all of "
+               "operation_counts,account_activity,transaction_sizes,fee_totals")
+         ("top", bpo::value<uint32_t>()->default_value(20), "Number of entries in rankings")
+         ("output,o", bpo::value<boost::filesystem::path>(), "Write the results to this JSON file instead of stdout");
+
+      bpo::variables_map options;
+      bpo::store( bpo::parse_command_line(argc, argv, opts), options );
+      bpo::notify( options );
+
+      if( options.count("help") > 0 )
+      {
+         std::cout << "Computes statistics over a block log without running a node\n\n" << opts << "\n";
+         return 0;
+      }
+
+      fc::path block_log_dir = fc::path( options.at("data-dir").as<boost::filesystem::path>() )
+                               / "blockchain" / "database" / "block_num_to_block";
+      if( options.count("block-log-dir") > 0 )
+         block_log_dir = options.at("block-log-dir").as<boost::filesystem::path>();
+      const mapped_block_database blocks( block_log_dir );
+
+      const uint32_t first_block = std::max( 1u, options.at("first-block").as<uint32_t>() );
+      uint32_t last_block = options.at("last-block").as<uint32_t>();
+      if( last_block == 0 || last_block > blocks.last_block_num() )
+         last_block = blocks.last_block_num();
+      FC_ASSERT( first_block <= last_block, "No blocks to analyze in ${d}", ("d", block_log_dir) );
+
+      std::vector<std::string> names;
+      const string statistics = options.at("statistics").as<string>();
+      if( !statistics.empty() )
+         boost::split( names, statistics, boost::is_any_of(",") );
+      accumulator_set results = make_accumulators( names );
+
+      const uint32_t thread_count = std::max( 1u, options.at("threads").as<uint32_t>() );
+      const uint32_t chunk_size = std::max( 1u, options.at("chunk-size").as<uint32_t>() );
+      std::cerr << "Analyzing blocks " << first_block << " to " << last_block << " of " << block_log_dir.string()
+                << " on " << thread_count << " threads\n";
+
+      // Threads take chunks of consecutive blocks in turn, since block sizes vary a lot across the chain
+      std::atomic<uint64_t> next_block( first_block );
+      std::atomic<uint64_t> missing_blocks( 0 );
+      std::vector<accumulator_set> partials( thread_count );
+      std::vector<fc::exception_ptr> errors( thread_count );
+      std::vector<std::thread> threads;
+      const auto start = fc::time_point::now();
+      for( uint32_t t = 0; t < thread_count; ++t )
+      {
+         for( const auto& r : results )
+            partials[t].emplace_back( r.first, r.second->clone_empty() );
+         threads.emplace_back( [&blocks,&next_block,&missing_blocks,&partials,&errors,t,chunk_size,last_block]() {
+            try
+            {
+               auto& accumulators = partials[t];
+               while( true )
+               {
+                  const uint64_t begin = next_block.fetch_add( chunk_size );
+                  if( begin > last_block )
+                     break;
+                  const uint64_t end = std::min<uint64_t>( begin + chunk_size - 1, last_block );
+                  for( uint64_t num = begin; num <= end; ++num )
+                  {
+                     auto view = blocks.fetch_view( uint32_t( num ) );
+                     if( !view.valid() )
+                     {
+                        ++missing_blocks;
+                        continue;
+                     }
+                     const signed_block block = view->block();
+                     for( auto& a : accumulators )
+                        a.second->add_block( block );
+                  }
+               }
+            }
+            catch( const fc::exception& e )
+            {
+               errors[t] = e.dynamic_copy_exception();
+            }
+         });
+      }
+      for( auto& thread : threads )
+         thread.join();
+      for( const auto& e : errors )
+         if( e )
+            e->dynamic_rethrow_exception();
+
+      for( const auto& partial : partials )
+         for( size_t i = 0; i < results.size(); ++i )
+            results[i].second->merge( *partial[i].second );
+      const double seconds = double( ( fc::time_point::now() - start ).count() ) / 1000000.0;
+
+      const uint32_t top = options.at("top").as<uint32_t>();
+      fc::mutable_variant_object stats;
+      for( const auto& r : results )
+         stats( r.first, r.second->result( top ) );
+      fc::mutable_variant_object report;
+      report( "first_block", first_block )
+            ( "last_block", last_block )
+            ( "missing_blocks", missing_blocks.load() )
+            ( "seconds", seconds )
+            ( "blocks_per_second", seconds > 0 ? ( last_block - first_block + 1 ) / seconds : 0.0 )
+            ( "statistics", stats );
+
+      if( options.count("output") > 0 )
+         fc::json::save_to_file( fc::variant( report ), options.at("output").as<boost::filesystem::path>() );
+      else
+         std::cout << fc::json::to_pretty_string( fc::variant( report ) ) << "\n";
+      return 0;
+   }
+   catch( const fc::exception& e )
+   {
+      std::cerr << e.to_detail_string() << "\n";
+   }
+   return 1;
+}
@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <graphene/app/api.hpp>
+#include <graphene/chain/config.hpp>
+#include <graphene/protocol/fee_schedule.hpp>
+#include <graphene/utilities/key_conversion.hpp>
+
+#include <fc/network/http/websocket.hpp>
+#include <fc/rpc/websocket_api.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+using namespace graphene::app;
+using namespace graphene::chain;
+namespace bpo = boost::program_options;
+
+namespace {
+
+/// Time for a transaction to be included after the time it is planned to be sent at
+const uint32_t expiration_margin_seconds = 60;
+
+enum load_kind { transfer_load, order_load, feed_load, update_load, load_kind_count };
+const char* const load_kind_names[] = { "transfer", "order", "feed", "update" };
+
+struct load_account
+{
+   string            name;
+   account_object    object;
+   private_key_type  key;
+};
+
+/// What the transactions are built from, fetched from the node before signing
+struct load_context
+{
+   chain_id_type              chain_id;
+   block_id_type              reference_block;
+   /// Transaction i is planned to be sent @ref tps times i seconds after this
+   fc::time_point_sec         first_send_time;
+   double                     tps = 0;
+   fee_schedule               fees;
+   vector<load_account>       accounts;
+   optional<asset_id_type>    market_asset;
+   optional<asset_id_type>    feed_asset;
+   asset_id_type              feed_backing_asset;
+};
+
+/// Parse a mix like "transfer=70,order=20,update=10" into cumulative weights
+std::array<uint32_t, load_kind_count> parse_mix( const string& mix )
+{
+   std::array<uint32_t, load_kind_count> weights{};
+   vector<string> parts;
+   boost::split( parts, mix, boost::is_any_of(",") );
+   for( const auto& part : parts )
+   {
+      auto eq = part.find('=');
+      FC_ASSERT( eq != string::npos, "Invalid operation mix entry ${p}", ("p",part) );
+      const string name = boost::trim_copy( part.substr( 0, eq ) );
+      auto itr = std::find_if( std::begin(load_kind_names), std::end(load_kind_names),
+                               [&name]( const char* n ) { return name == n; } );
+      FC_ASSERT( itr != std::end(load_kind_names), "Unknown operation kind ${n}", ("n",name) );
+      weights[ itr - std::begin(load_kind_names) ] = std::stoul( part.substr( eq + 1 ) );
+   }
+   for( size_t i = 1; i < weights.size(); ++i )
+      weights[i] += weights[i-1];
+   FC_ASSERT( weights.back() > 0, "The operation mix is empty" );
+   return weights;
+}
+
+/**
+ * Build and sign transaction @p i. A field of the operation is derived from @p i, so that none of the transactions
+ * is a duplicate of another. The transaction expires a margin after the time it is planned to be sent at.
+ */
+signed_transaction build_transaction( const load_context& ctx, const std::array<uint32_t, load_kind_count>& mix,
+                                      uint64_t i )
+{
+   const load_account& from = ctx.accounts[ i % ctx.accounts.size() ];
+   const load_account& to = ctx.accounts[ ( i + 1 ) % ctx.accounts.size() ];
+
+   const uint32_t pick = static_cast<uint32_t>( ( i * 2654435761u ) % mix.back() );
+   const auto kind = std::upper_bound( mix.begin(), mix.end(), pick ) - mix.begin();
+
+   operation op;
+   switch( kind )
+   {
+   case transfer_load:
+   {
+      transfer_operation t;
+      t.from = from.object.get_id();
+      t.to = to.object.get_id();
+      t.amount = asset( 1 + i );
+      op = t;
+      break;
+   }
+   case order_load:
+   {
+      limit_order_create_operation o;
+      o.seller = from.object.get_id();
+      o.amount_to_sell = asset( 1 );
+      o.min_to_receive = asset( 1 + i, *ctx.market_asset );
+      o.expiration = fc::time_point_sec::maximum();
+      op = o;
+      break;
+   }
+   case feed_load:
+   {
+      asset_publish_feed_operation f;
+      f.publisher = from.object.get_id();
+      f.asset_id = *ctx.feed_asset;
+      // keep the prices within a range, the quote amount tells each thousand transactions apart
+      const share_type base_amount = 100 + i % 1000;
+      const share_type quote_amount = 100 + i / 1000;
+      f.feed.settlement_price = asset( base_amount, *ctx.feed_asset ) / asset( quote_amount, ctx.feed_backing_asset );
+      f.feed.core_exchange_rate = asset( base_amount, *ctx.feed_asset ) / asset( quote_amount );
+      op = f;
+      break;
+   }
+   default:
+   {
+      account_update_operation u;
+      u.account = from.object.get_id();
+      u.new_options = from.object.options;
+      // the memo key is the only option which can vary without changing the votes, derive it from i
+      u.new_options->memo_key = fc::ecc::private_key::regenerate(
+            fc::sha256::hash( from.key.get_secret().str() + std::to_string( i ) ) ).get_public_key();
+      op = u;
+      break;
+   }
+   }
+   ctx.fees.set_fee( op );
+
+   signed_transaction trx;
+   trx.operations.push_back( std::move(op) );
+   trx.set_reference_block( ctx.reference_block );
+   const uint32_t send_offset = static_cast<uint32_t>( i / ctx.tps );
+   trx.set_expiration( ctx.first_send_time + send_offset + expiration_margin_seconds );
+   trx.sign( from.key, ctx.chain_id );
+   return trx;
+}
+
+/// Build and sign all transactions on @p threads threads
+vector<signed_transaction> presign( const load_context& ctx, const std::array<uint32_t, load_kind_count>& mix,
+                                    uint64_t count, uint32_t threads )
+{
+   vector<signed_transaction> result( count );
+   vector<std::thread> workers;
+   for( uint32_t t = 0; t < threads; ++t )
+      workers.emplace_back( [&ctx, &mix, &result, count, threads, t]() {
+         for( uint64_t i = t; i < count; i += threads )
+            result[i] = build_transaction( ctx, mix, i );
+      } );
+   for( auto& w : workers )
+      w.join();
+   return result;
+}
+
+struct connection
+{
+   fc::http::websocket_client                         client;
+   fc::http::websocket_connection_ptr                 socket;
+   std::shared_ptr<fc::rpc::websocket_api_connection> api_connection;
+   fc::api<database_api>                              db;
+   fc::api<network_broadcast_api>                     broadcast;
+};
+
+std::shared_ptr<connection> connect( const string& endpoint, const string& user, const string& password )
+{
+   auto result = std::make_shared<connection>();
+   result->socket = result->client.connect( endpoint );
+   result->api_connection = std::make_shared<fc::rpc::websocket_api_connection>( result->socket,
+                                                                                 GRAPHENE_MAX_NESTED_OBJECTS );
+   auto login = result->api_connection->get_remote_api< login_api >(1);
+   FC_ASSERT( login->login( user, password ), "Failed to log in to API server" );
+   result->db = login->database();
+   result->broadcast = login->network_broadcast();
+   return result;
+}
+
+/// Results of replaying the transactions, updated only by tasks of the main thread
+struct load_statistics
+{
+   uint64_t                                    sent = 0;
+   uint64_t                                    accepted = 0;
+   uint64_t                                    rejected = 0;
+   std::map<string, uint64_t>                  rejections;
+   std::map<transaction_id_type, fc::time_point> in_flight;
+   vector<int64_t>                             inclusion_latencies;
+   uint32_t                                    blocks = 0;
+   uint32_t                                    max_block_transactions = 0;
+   uint64_t                                    block_transactions = 0;
+   uint32_t                                    missed_blocks = 0;
+};
+
+/// Follow new blocks and match their transactions against the ones in flight
+void watch_blocks( connection& con, load_statistics& stats, const bool& done )
+{
+   auto props = con.db->get_dynamic_global_properties();
+   uint32_t next_block = props.head_block_number + 1;
+   const uint32_t first_missed = props.recently_missed_count;
+   while( !done )
+   {
+      fc::usleep( fc::milliseconds(100) );
+      props = con.db->get_dynamic_global_properties();
+      for( ; next_block <= props.head_block_number; ++next_block )
+      {
+         auto block = con.db->get_block( next_block );
+         if( !block.valid() )
+            break;
+         const auto now = fc::time_point::now();
+         ++stats.blocks;
+         stats.block_transactions += block->transactions.size();
+         stats.max_block_transactions = std::max<uint32_t>( stats.max_block_transactions,
+                                                             block->transactions.size() );
+         for( const auto& trx : block->transactions )
+         {
+            auto itr = stats.in_flight.find( trx.id() );
+            if( itr == stats.in_flight.end() )
+               continue;
+            stats.inclusion_latencies.push_back( ( now - itr->second ).count() );
+            stats.in_flight.erase( itr );
+         }
+      }
+      stats.missed_blocks = props.recently_missed_count > first_missed ? props.recently_missed_count - first_missed
+                                                                      : 0;
+   }
+}
+
+int64_t percentile( vector<int64_t>& values, double p )
+{
+   if( values.empty() )
+      return 0;
+   const size_t n = std::min( values.size() - 1, static_cast<size_t>( p * values.size() ) );
+   std::nth_element( values.begin(), values.begin() + n, values.end() );
+   return values[n];
+}
+
+void print_report( load_statistics& stats, double target_tps, int64_t send_micros )
+{
+   const double seconds = std::max<int64_t>( send_micros, 1 ) / 1000000.0;
+   std::cout << std::fixed << std::setprecision(1)
+             << "Sent " << stats.sent << " transactions in " << seconds << "s, "
+             << ( stats.sent / seconds ) << " tx/s (target " << target_tps << " tx/s)\n"
+             << "Accepted " << stats.accepted << ", rejected " << stats.rejected << ", accept rate "
+             << ( stats.sent > 0 ? 100.0 * stats.accepted / stats.sent : 0.0 ) << "%\n";
+   for( const auto& r : stats.rejections )
+      std::cout << "  " << r.second << " x " << r.first << "\n";
+   const size_t included = stats.inclusion_latencies.size();
+   std::cout << "Included " << included << " of the accepted transactions, "
+             << stats.in_flight.size() << " still pending\n";
+   if( included > 0 )
+   {
+      int64_t total = 0;
+      for( auto l : stats.inclusion_latencies )
+         total += l;
+      std::cout << "Inclusion latency ms: avg " << ( total / included / 1000.0 )
+                << ", p50 " << ( percentile( stats.inclusion_latencies, 0.5 ) / 1000.0 )
+                << ", p95 " << ( percentile( stats.inclusion_latencies, 0.95 ) / 1000.0 )
+                << ", max " << ( percentile( stats.inclusion_latencies, 1.0 ) / 1000.0 ) << "\n";
+   }
+   std::cout << "Node: " << stats.blocks << " blocks, "
+             << ( stats.blocks > 0 ? double( stats.block_transactions ) / stats.blocks : 0.0 )
+             << " transactions per block on average, " << stats.max_block_transactions << " at most, "
+             << stats.missed_blocks << " missed blocks\n";
+}
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+   try {
+      bpo::options_description opts;
+      opts.add_options()
+         ("help,h", "Print this help message and exit.")
+         ("server-rpc-endpoint,s", bpo::value<string>()->default_value("ws://127.0.0.1:8090"),
+               "Server websocket RPC endpoint")
+         ("server-rpc-user,u", bpo::value<string>()->default_value(""), "Server Username")
+         ("server-rpc-password,p", bpo::value<string>()->default_value(""), "Server Password")
+         ("account,a", bpo::value<vector<string>>()->composing(),
+               "Funded account which sends transactions, as NAME=WIF of its active key, may be repeated")
+         ("transactions,n", bpo::value<uint64_t>()->default_value(10000), "Number of transactions to send")
+         ("tps,t", bpo::value<double>()->default_value(100), "Target transactions per second")
+         ("connections,c", bpo::value<uint32_t>()->default_value(8), "Number of websocket connections")
+         ("signing-threads", bpo::value<uint32_t>()->default_value(std::max(1u, std::thread::hardware_concurrency())),
+               "Number of threads signing the transactions before sending")
+         ("signing-seconds", bpo::value<uint32_t>()->default_value(120),
+               "Seconds allowed for signing, the transactions expire as if they were sent after this time")
+         ("mix,m", bpo::value<string>()->default_value("transfer=100"),
+               "Weights of the operations, e.g. transfer=70,order=20,feed=5,update=5")
+         ("market-asset", bpo::value<string>(), "Asset bought with CORE by the orders")
+         ("feed-asset", bpo::value<string>(), "Asset the accounts publish feeds for, they must be its producers")
+         ("feed-backing-asset", bpo::value<string>()->default_value(GRAPHENE_SYMBOL),
+               "Backing asset of the feed asset")
+         ("drain-seconds", bpo::value<uint32_t>()->default_value(10),
+               "Seconds to wait for the last transactions to be included after sending");
+
+      bpo::variables_map options;
+      bpo::store( bpo::parse_command_line(argc, argv, opts), options );
+      bpo::notify( options );
+
+      if( options.count("help") > 0 || options.count("account") == 0 )
+      {
+         std::cout << "Sends pre-signed transactions to a node at a fixed rate, without waiting for replies\n\n"
+                   << opts << "\n";
+         return options.count("help") > 0 ? 0 : 1;
+      }
+
+      const auto mix = parse_mix( options.at("mix").as<string>() );
+      const uint64_t count = options.at("transactions").as<uint64_t>();
+      const double tps = options.at("tps").as<double>();
+      const uint32_t connection_count = std::max( 1u, options.at("connections").as<uint32_t>() );
+      FC_ASSERT( tps > 0, "The target rate must be positive" );
+
+      vector<std::shared_ptr<connection>> connections;
+      for( uint32_t i = 0; i < connection_count; ++i )
+         connections.push_back( connect( options.at("server-rpc-endpoint").as<string>(),
+                                         options.at("server-rpc-user").as<string>(),
+                                         options.at("server-rpc-password").as<string>() ) );
+      auto& db = connections.front()->db;
+
+      load_context ctx;
+      ctx.chain_id = db->get_chain_id();
+      const auto props = db->get_dynamic_global_properties();
+      ctx.reference_block = props.head_block_id;
+      const auto gprops = db->get_global_properties();
+      ctx.fees = gprops.parameters.get_current_fees();
+      // Transactions are sent after signing, at most signing_seconds later than planned, so that they can not be
+      // expired when sent. If signing is faster, they expire at most this much further in the future when sent.
+      const uint32_t signing_seconds = options.at("signing-seconds").as<uint32_t>();
+      FC_ASSERT( uint64_t(signing_seconds) + expiration_margin_seconds
+                    <= gprops.parameters.maximum_time_until_expiration,
+                 "The signing time plus ${m} seconds must not exceed the maximum expiration time of ${e} seconds",
+                 ("m",expiration_margin_seconds)("e",gprops.parameters.maximum_time_until_expiration) );
+      ctx.first_send_time = props.time + signing_seconds;
+      ctx.tps = tps;
+
+      vector<string> names;
+      for( const auto& a : options.at("account").as<vector<string>>() )
+      {
+         auto eq = a.find('=');
+         FC_ASSERT( eq != string::npos, "Accounts are given as NAME=WIF" );
+         load_account account;
+         account.name = a.substr( 0, eq );
+         auto key = graphene::utilities::wif_to_key( a.substr( eq + 1 ) );
+         FC_ASSERT( key.valid(), "Invalid private key of account ${a}", ("a",account.name) );
+         account.key = *key;
+         names.push_back( account.name );
+         ctx.accounts.push_back( std::move(account) );
+      }
+      const auto objects = db->lookup_account_names( names );
+      for( size_t i = 0; i < objects.size(); ++i )
+      {
+         FC_ASSERT( objects[i].valid(), "Unknown account ${a}", ("a",names[i]) );
+         ctx.accounts[i].object = *objects[i];
+      }
+
+      auto find_asset = [&db]( const string& symbol ) {
+         auto found = db->lookup_asset_symbols( { symbol } );
+         FC_ASSERT( found.size() == 1 && found[0].valid(), "Unknown asset ${s}", ("s",symbol) );
+         return found[0]->get_id();
+      };
+      if( options.count("market-asset") > 0 )
+         ctx.market_asset = find_asset( options.at("market-asset").as<string>() );
+      if( options.count("feed-asset") > 0 )
+         ctx.feed_asset = find_asset( options.at("feed-asset").as<string>() );
+      ctx.feed_backing_asset = find_asset( options.at("feed-backing-asset").as<string>() );
+      FC_ASSERT( mix[order_load] == mix[transfer_load] || ctx.market_asset.valid(),
+                 "Orders need --market-asset" );
+      FC_ASSERT( mix[feed_load] == mix[order_load] || ctx.feed_asset.valid(), "Feeds need --feed-asset" );
+
+      auto start = fc::time_point::now();
+      const auto transactions = presign( ctx, mix, count, options.at("signing-threads").as<uint32_t>() );
+      const auto signing_time = fc::time_point::now() - start;
+      std::cout << "Signed " << count << " transactions in " << signing_time.count() / 1000 << "ms\n";
+      FC_ASSERT( signing_time < fc::seconds( signing_seconds ),
+                 "Signing took longer than ${s} seconds, the transactions would expire too early, "
+                 "please increase signing-seconds", ("s",signing_seconds) );
+
+      load_statistics stats;
+      bool done = false;
+      auto watcher = fc::async( [&connections, &stats, &done]() {
+         watch_blocks( *connections.front(), stats, done );
+      } );
+
+      // Open loop: transaction i is sent at start + i / tps, whether or not earlier ones have been answered
+      vector<fc::future<void>> replies;
+      replies.reserve( count );
+      start = fc::time_point::now();
+      for( uint64_t i = 0; i < count; ++i )
+      {
+         const auto due = start + fc::microseconds( static_cast<int64_t>( i * 1000000.0 / tps ) );
+         if( due > fc::time_point::now() )
+            fc::usleep( due - fc::time_point::now() );
+         const signed_transaction& trx = transactions[i];
+         auto con = connections[ i % connections.size() ];
+         ++stats.sent;
+         stats.in_flight[ trx.id() ] = fc::time_point::now();
+         replies.push_back( fc::async( [con, &trx, &stats]() {
+            try
+            {
+               con->broadcast->broadcast_transaction( trx );
+               ++stats.accepted;
+            }
+            catch( const fc::exception& e )
+            {
+               ++stats.rejected;
+               ++stats.rejections[ e.top_message() ];
+               stats.in_flight.erase( trx.id() );
+            }
+         } ) );
+      }
+      const int64_t send_micros = ( fc::time_point::now() - start ).count();
+      for( auto& r : replies )
+         r.wait();
+
+      const auto drain_until = fc::time_point::now() + fc::seconds( options.at("drain-seconds").as<uint32_t>() );
+      while( !stats.in_flight.empty() && fc::time_point::now() < drain_until )
+         fc::usleep( fc::milliseconds(100) );
+      done = true;
+      watcher.wait();
+
+      print_report( stats, tps, send_micros );
+      return 0;
+   }
+   catch( const fc::exception& e )
+   {
+      std::cerr << e.to_detail_string() << "\n";
+   }
+   return 1;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/chain/database.hpp>
+
+#include <fc/log/logger.hpp>
+
+#include "../common/database_fixture.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace graphene::chain;
+using namespace graphene::chain::test;
+
+namespace {
+   std::atomic<uint64_t> allocation_count{ 0 };
+}
+
+// Count every allocation made by this benchmark, which is why it is built as its own executable
+void* operator new( std::size_t size )
+{
+   allocation_count.fetch_add( 1, std::memory_order_relaxed );
+   if( void* p = std::malloc( size == 0 ? 1 : size ) )
+      return p;
+   throw std::bad_alloc();
+}
+void operator delete( void* p ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t ) noexcept { std::free( p ); }
+
+BOOST_FIXTURE_TEST_SUITE( allocation_benchmarks, database_fixture )
+
+BOOST_AUTO_TEST_CASE( block_application_allocations )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice, asset(100000000) );
+   generate_block();
+
+   const uint32_t blocks = 20;
+   const uint32_t transactions_per_block = 200;
+   uint64_t total_allocations = 0;
+
+   for( uint32_t b = 0; b < blocks; ++b )
+   {
+      for( uint32_t t = 0; t < transactions_per_block; ++t )
+      {
+         transfer_operation op;
+         op.from = alice_id;
+         op.to = bob_id;
+         op.amount = asset( 1 + b * transactions_per_block + t ); // unique transactions
+         trx.operations.push_back( op );
+         for( auto& o : trx.operations ) db.current_fee_schedule().set_fee( o );
+         set_expiration( db, trx );
+         PUSH_TX( db, trx, ~0 );
+         trx.clear();
+      }
+
+      // Producing the block applies the pending transactions again, then the block itself is applied
+      const uint64_t before = allocation_count.load( std::memory_order_relaxed );
+      generate_block();
+      const uint64_t allocations = allocation_count.load( std::memory_order_relaxed ) - before;
+      total_allocations += allocations;
+      BOOST_CHECK_EQUAL( db.fetch_block_by_number( db.head_block_num() )->transactions.size(),
+                         transactions_per_block );
+   }
+
+   wlog( "Block production and application: ${a} allocations per transfer",
+         ("a",total_allocations/(uint64_t(blocks)*transactions_per_block)) );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <fc/variant.hpp>
+
+#include <functional>
+#include <string>
+
+namespace graphene { namespace chain { namespace test {
+
+/// Settings shared by all benchmarks, given on the command line after "--"
+struct benchmark_config
+{
+   uint32_t    scale = 10000;         ///< Operations applied per repetition
+   uint32_t    ops_per_block = 1000;  ///< Operations per block
+   uint32_t    warmup = 1;            ///< Repetitions run before measuring
+   uint32_t    repetitions = 3;       ///< Measured repetitions
+   bool        with_history = false;  ///< Whether the history plugins are enabled
+   std::string json_file;             ///< File the results are written to, none if empty
+   std::string state_dir;             ///< Directory made by generate_synthetic_state, to be replayed
+
+   /// Number of blocks needed to apply @ref scale operations
+   uint32_t blocks_per_repetition()const { return ( scale + ops_per_block - 1 ) / ops_per_block; }
+
+   static const benchmark_config& get();
+};
+
+/**
+ * Run a workload: @p apply_block is called @p blocks_per_repetition times per repetition, is timed, and returns
+ * the number of operations it applied. Its argument is the number of operations applied by previous calls,
+ * which workloads use to keep their transactions unique.
+ *
+ * The results of the measured repetitions are logged and added to the JSON report.
+ */
+void run_benchmark( const std::string& workload, uint32_t blocks_per_repetition,
+                    const std::function<uint64_t( uint64_t applied_ops )>& apply_block );
+
+} } } // graphene::chain::test
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/chain/database.hpp>
+#include <graphene/chain/asset_object.hpp>
+#include <graphene/chain/block_database.hpp>
+#include <graphene/chain/witness_object.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/io/fstream.hpp>
+#include <fc/io/json.hpp>
+
+#include "../common/database_fixture.hpp"
+
+#include "benchmark.hpp"
+
+using namespace graphene::chain;
+using namespace graphene::chain::test;
+
+namespace {
+
+/// Builds the transactions of the workloads and applies them the way a node does
+struct benchmark_fixture : database_fixture_init<benchmark_fixture>
+{
+   const benchmark_config& config = benchmark_config::get();
+
+   static std::shared_ptr<boost::program_options::variables_map> init_options( database_fixture_base& fixture )
+   {
+      fixture.with_history_plugins = benchmark_config::get().with_history;
+      return database_fixture_base::init_options( fixture );
+   }
+
+   /// The key of an account made by ACTOR, or of one which uses the key of the initial accounts
+   fc::ecc::private_key signing_key( account_id_type id )const
+   {
+      const account_object& account = id( db );
+      if( account.active.key_auths.count( init_account_pub_key ) > 0 )
+         return init_account_priv_key;
+      return generate_private_key( account.name );
+   }
+
+   /// Push a signed transaction with a single operation into the pending state, as received from a client
+   void push( operation op )
+   {
+      db.current_fee_schedule().set_fee( op );
+      flat_set<account_id_type> active;
+      flat_set<account_id_type> owner;
+      vector<authority> other;
+      operation_get_required_authorities( op, active, owner, other, false );
+      trx.operations.push_back( std::move(op) );
+      set_expiration( db, trx );
+      for( const account_id_type signer : active )
+         sign( trx, signing_key( signer ) );
+      PUSH_TX( db, trx );
+      trx.clear();
+   }
+
+   /// Push @p make(i) for the next block's operations and produce the block, which applies them again
+   template<typename Make>
+   uint64_t apply_block( uint64_t applied_ops, Make&& make )
+   {
+      for( uint64_t i = applied_ops; i < applied_ops + config.ops_per_block; ++i )
+         push( make( i ) );
+      generate_block( database::skip_nothing );
+      return config.ops_per_block;
+   }
+
+   template<typename Make>
+   void run( const std::string& workload, Make&& make )
+   {
+      run_benchmark( workload, config.blocks_per_repetition(), [this,&make]( uint64_t applied_ops ) {
+         return apply_block( applied_ops, make );
+      } );
+   }
+
+   account_create_operation make_benchmark_account( uint64_t i )const
+   {
+      account_create_operation aco;
+      aco.name = "bench" + fc::to_string( i );
+      aco.registrar = get_account( "init0" ).get_id();
+      aco.owner = authority( 1, init_account_pub_key, 1 );
+      aco.active = authority( 1, init_account_pub_key, 1 );
+      aco.options.memo_key = init_account_pub_key;
+      aco.options.voting_account = GRAPHENE_PROXY_TO_SELF_ACCOUNT;
+      return aco;
+   }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE( chain_benchmarks, benchmark_fixture )
+
+BOOST_AUTO_TEST_CASE( transfers )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice, asset(10000000000000) );
+   generate_block();
+
+   run( "transfers", [&]( uint64_t i ) {
+      transfer_operation op;
+      op.from = alice_id;
+      op.to = bob_id;
+      op.amount = asset( 1 + i );
+      return op;
+   } );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( account_creation )
+{ try {
+   run( "account_creation", [this]( uint64_t i ) {
+      return make_benchmark_account( i );
+   } );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( order_placement )
+{ try {
+   ACTOR( alice );
+   fund( alice, asset(10000000000000) );
+   const asset_id_type bench_id = create_user_issued_asset( "BENCH" ).get_id();
+   generate_block();
+
+   // Orders far from each other's price which stay on the book
+   run( "order_placement", [&]( uint64_t i ) {
+      limit_order_create_operation op;
+      op.seller = alice_id;
+      op.amount_to_sell = asset( 1 );
+      op.min_to_receive = asset( 1000000 + i, bench_id );
+      op.expiration = fc::time_point_sec::maximum();
+      return op;
+   } );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( order_matching )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice, asset(10000000000000) );
+   const asset_id_type bench_id = create_user_issued_asset( "BENCH" ).get_id();
+   issue_uia( bob_id, asset( 10000000000000, bench_id ) );
+   generate_block();
+
+   // Every other order fills the previous one completely
+   run( "order_matching", [&]( uint64_t i ) {
+      const share_type amount = 10 + i / 2;
+      limit_order_create_operation op;
+      op.seller = ( i % 2 == 0 ) ? alice_id : bob_id;
+      op.amount_to_sell = ( i % 2 == 0 ) ? asset( amount ) : asset( amount, bench_id );
+      op.min_to_receive = ( i % 2 == 0 ) ? asset( amount, bench_id ) : asset( amount );
+      op.expiration = fc::time_point_sec::maximum();
+      return op;
+   } );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( feed_publishing )
+{ try {
+   ACTOR( alice );
+   fund( alice, asset(10000000000000) );
+   const asset_id_type bit_id = create_bitasset( "BENCHBIT", alice_id ).get_id();
+   update_feed_producers( bit_id, { alice_id } );
+   generate_block();
+
+   run( "feed_publishing", [&]( uint64_t i ) {
+      asset_publish_feed_operation op;
+      op.publisher = alice_id;
+      op.asset_id = bit_id;
+      op.feed.settlement_price = asset( 100 + i % 1000, bit_id ) / asset( 10 + i / 1000 );
+      op.feed.core_exchange_rate = op.feed.settlement_price;
+      return op;
+   } );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( proposals )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice, asset(10000000000000) );
+   generate_block();
+
+   run( "proposals", [&]( uint64_t i ) {
+      transfer_operation top;
+      top.from = alice_id;
+      top.to = bob_id;
+      top.amount = asset( 1 + i );
+      proposal_create_operation op;
+      op.fee_paying_account = alice_id;
+      op.expiration_time = db.head_block_time() + fc::hours(1);
+      op.proposed_ops.emplace_back( top );
+      return op;
+   } );
+} FC_LOG_AND_RETHROW() }
+
+/// Maintenance of a chain with @a scale accounts which vote, one maintenance interval per block
+BOOST_AUTO_TEST_CASE( maintenance_intervals )
+{ try {
+   const vote_id_type vote = witness_id_type(1)(db).vote_id;
+   for( uint64_t i = 0; i < config.scale; i += config.ops_per_block )
+      apply_block( i, [this,&vote]( uint64_t n ) {
+         account_create_operation op = make_benchmark_account( n );
+         op.options.votes.insert( vote );
+         op.options.num_witness = 1;
+         return op;
+      } );
+
+   run_benchmark( "maintenance_intervals", 1, [this]( uint64_t ) {
+      generate_blocks( db.get_dynamic_global_properties().next_maintenance_time, true, database::skip_nothing );
+      return uint64_t( config.scale );
+   } );
+} FC_LOG_AND_RETHROW() }
+
+/// Maintenance paying out the fees of @a scale accounts registered by a few lifetime members
+BOOST_AUTO_TEST_CASE( fee_payouts )
+{ try {
+   ACTORS( (reg0)(reg1)(reg2)(reg3) );
+   const std::vector<account_id_type> registrars { reg0_id, reg1_id, reg2_id, reg3_id };
+   for( const account_id_type registrar : registrars )
+   {
+      fund( registrar( db ), asset(10000000000000) );
+      upgrade_to_lifetime_member( registrar );
+   }
+   generate_block();
+
+   std::vector<account_statistics_id_type> payers;
+   for( uint64_t i = 0; i < config.scale; i += config.ops_per_block )
+      apply_block( i, [this,&registrars]( uint64_t n ) {
+         account_create_operation op = make_benchmark_account( n );
+         op.registrar = registrars[ n % registrars.size() ];
+         op.referrer = op.registrar;
+         return op;
+      } );
+   for( uint64_t i = 0; i < config.scale; ++i )
+      payers.push_back( get_account( "bench" + fc::to_string( i ) ).statistics );
+
+   // Setting the pending fees is measured too, it costs the same whichever way they are paid out.
+   // The fees are taken from a registrar to keep the supply consistent.
+   run_benchmark( "fee_payouts", 1, [this,&payers,&reg0_id]( uint64_t ) {
+      db.adjust_balance( reg0_id, asset( -1100 * int64_t( payers.size() ) ) );
+      for( const account_statistics_id_type payer : payers )
+         db.modify( payer( db ), []( account_statistics_object& aso ) {
+            aso.pending_fees += 1000;
+            aso.pending_vested_fees += 100;
+         });
+      generate_blocks( db.get_dynamic_global_properties().next_maintenance_time, true, database::skip_nothing );
+      return uint64_t( config.scale );
+   } );
+} FC_LOG_AND_RETHROW() }
+
+/// Replay of the chain in the data directory made by generate_synthetic_state, given with --state-dir
+BOOST_AUTO_TEST_CASE( synthetic_state_replay )
+{ try {
+   if( config.state_dir.empty() )
+   {
+      BOOST_TEST_MESSAGE( "No --state-dir given, nothing to replay" );
+      return;
+   }
+   const fc::path state_dir( config.state_dir );
+
+   // The chain ID is computed from the file, as a node does
+   std::string genesis_json;
+   fc::read_file_contents( state_dir / "genesis.json", genesis_json );
+   genesis_state_type genesis = fc::json::from_string( genesis_json ).as<genesis_state_type>( 20 );
+   genesis.initial_chain_id = fc::sha256::hash( genesis_json );
+
+   block_database blocks;
+   blocks.open( state_dir / "blockchain" / "database" / "block_num_to_block" );
+   const auto last = blocks.last();
+   FC_ASSERT( last.valid(), "No blocks in ${d}", ("d",state_dir) );
+   const uint32_t runs = config.warmup + config.repetitions;
+   FC_ASSERT( last->block_num() >= runs, "Not enough blocks for ${r} repetitions", ("r",runs) );
+
+   fc::temp_directory replay_dir( graphene::utilities::temp_directory_path() );
+   database replay_db;
+   replay_db.open( replay_dir.path(), [&genesis]() { return genesis; }, "TEST" );
+   replay_db._undo_db.disable();
+
+   // What --replay-blockchain skips
+   const uint32_t skip = database::skip_witness_signature | database::skip_transaction_signatures
+                       | database::skip_transaction_dupe_check | database::skip_tapos_check
+                       | database::skip_merkle_check | database::skip_assert_evaluation
+                       | database::skip_undo_history_check | database::skip_witness_schedule_check;
+   uint32_t next_block = 1;
+   run_benchmark( "synthetic_state_replay", last->block_num() / runs, [&]( uint64_t ) {
+      const auto block = blocks.fetch_by_number( next_block++ );
+      FC_ASSERT( block.valid() );
+      replay_db.push_block( *block, skip );
+      uint64_t ops = 0;
+      for( const auto& trx : block->transactions )
+         ops += trx.operations.size();
+      return ops;
+   } );
+
+   replay_db.close();
+   blocks.close();
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../common/init_unit_test_suite.hpp"
+
+#include "benchmark.hpp"
+
+#include <fc/io/json.hpp>
+#include <fc/log/logger.hpp>
+#include <fc/time.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace graphene { namespace chain { namespace test {
+
+namespace {
+
+benchmark_config parse_config()
+{
+   benchmark_config config;
+   const auto& suite = boost::unit_test::framework::master_test_suite();
+   for( int i = 1; i < suite.argc; ++i )
+   {
+      const std::string arg = suite.argv[i];
+      const auto eq = arg.find( '=' );
+      const std::string name = arg.substr( 0, eq );
+      const std::string value = ( eq == std::string::npos ? std::string() : arg.substr( eq + 1 ) );
+      if( name == "--scale" )
+         config.scale = std::stoul( value );
+      else if( name == "--ops-per-block" )
+         config.ops_per_block = std::stoul( value );
+      else if( name == "--warmup" )
+         config.warmup = std::stoul( value );
+      else if( name == "--repetitions" )
+         config.repetitions = std::stoul( value );
+      else if( name == "--with-history" )
+         config.with_history = true;
+      else if( name == "--json" )
+         config.json_file = value;
+      else if( name == "--state-dir" )
+         config.state_dir = value;
+   }
+   FC_ASSERT( config.scale > 0 && config.ops_per_block > 0 && config.repetitions > 0,
+              "Scale, operations per block and repetitions must be positive" );
+   return config;
+}
+
+/// Peak resident set size of the process in KiB
+uint64_t peak_rss_kib()
+{
+#ifndef _WIN32
+   struct rusage usage;
+   if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+#ifdef __APPLE__
+      return usage.ru_maxrss / 1024;
+#else
+      return usage.ru_maxrss;
+#endif
+#endif
+   return 0;
+}
+
+double percentile_ms( std::vector<int64_t> sorted_micros, double p )
+{
+   if( sorted_micros.empty() )
+      return 0;
+   const size_t n = std::min( sorted_micros.size() - 1, static_cast<size_t>( p * sorted_micros.size() ) );
+   return sorted_micros[n] / 1000.0;
+}
+
+/// Results of all workloads run so far, the report is rewritten after each of them
+std::vector<fc::variant>& all_results()
+{
+   static std::vector<fc::variant> results;
+   return results;
+}
+
+void write_report()
+{
+   const auto& config = benchmark_config::get();
+   if( config.json_file.empty() )
+      return;
+   fc::mutable_variant_object report;
+   report( "config", fc::mutable_variant_object()
+                        ( "scale", config.scale )
+                        ( "ops_per_block", config.ops_per_block )
+                        ( "warmup", config.warmup )
+                        ( "repetitions", config.repetitions )
+                        ( "with_history", config.with_history ) )
+         ( "results", all_results() );
+   fc::json::save_to_file( fc::variant( report ), config.json_file );
+}
+
+} // namespace
+
+const benchmark_config& benchmark_config::get()
+{
+   static const benchmark_config config = parse_config();
+   return config;
+}
+
+void run_benchmark( const std::string& workload, uint32_t blocks_per_repetition,
+                    const std::function<uint64_t( uint64_t applied_ops )>& apply_block )
+{
+   const auto& config = benchmark_config::get();
+   uint64_t applied_ops = 0;
+   uint64_t measured_ops = 0;
+   int64_t measured_micros = 0;
+   std::vector<int64_t> block_micros;
+   block_micros.reserve( uint64_t(config.repetitions) * blocks_per_repetition );
+   fc::variants repetition_rates;
+
+   for( uint32_t r = 0; r < config.warmup + config.repetitions; ++r )
+   {
+      uint64_t repetition_ops = 0;
+      int64_t repetition_micros = 0;
+      for( uint32_t b = 0; b < blocks_per_repetition; ++b )
+      {
+         const auto start = fc::time_point::now();
+         const uint64_t ops = apply_block( applied_ops );
+         const int64_t micros = ( fc::time_point::now() - start ).count();
+         applied_ops += ops;
+         repetition_ops += ops;
+         repetition_micros += micros;
+         if( r >= config.warmup )
+            block_micros.push_back( micros );
+      }
+      if( r < config.warmup )
+         continue;
+      measured_ops += repetition_ops;
+      measured_micros += repetition_micros;
+      repetition_rates.emplace_back( repetition_ops * 1000000.0 / std::max<int64_t>( repetition_micros, 1 ) );
+   }
+
+   std::sort( block_micros.begin(), block_micros.end() );
+   const double ops_per_second = measured_ops * 1000000.0 / std::max<int64_t>( measured_micros, 1 );
+   const uint64_t rss = peak_rss_kib();
+   wlog( "${w}: ${r} ops/s, block p50 ${p50}ms p99 ${p99}ms, peak RSS ${rss} KiB",
+         ("w",workload)("r",ops_per_second)("p50",percentile_ms( block_micros, 0.5 ))
+         ("p99",percentile_ms( block_micros, 0.99 ))("rss",rss) );
+
+   all_results().emplace_back( fc::mutable_variant_object()
+         ( "workload", workload )
+         ( "operations", measured_ops )
+         ( "seconds", measured_micros / 1000000.0 )
+         ( "ops_per_second", ops_per_second )
+         ( "repetition_ops_per_second", repetition_rates )
+         ( "blocks", block_micros.size() )
+         ( "block_ms_p50", percentile_ms( block_micros, 0.5 ) )
+         ( "block_ms_p99", percentile_ms( block_micros, 0.99 ) )
+         ( "block_ms_max", percentile_ms( block_micros, 1.0 ) )
+         ( "peak_rss_kib", rss ) );
+   write_report();
+}
+
+} } } // graphene::chain::test
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/protocol/fee_schedule.hpp>
+#include <graphene/protocol/operations.hpp>
+
+#include <fc/io/json.hpp>
+#include <fc/io/raw.hpp>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+
+#include "benchmark.hpp"
+
+using namespace graphene::protocol;
+using namespace graphene::chain::test;
+
+namespace {
+
+/**
+ * Fills the reflected protocol types with random values which survive the binary and JSON round trips.
+ *
+ * Containers and optionals nested deeper than @ref max_depth are left empty, which bounds recursive types such as
+ * proposed operations and custom authority restrictions.
+ */
+class random_generator
+{
+   public:
+      static constexpr uint32_t max_depth = 3;
+      static constexpr uint32_t max_elements = 3;
+
+      explicit random_generator( uint64_t seed ) : _rng( seed )
+      {
+         for( uint32_t i = 0; i < 8; ++i )
+            _keys.push_back( fc::ecc::private_key::regenerate( fc::sha256::hash( "key" + fc::to_string(i) ) )
+                                                                                              .get_public_key() );
+      }
+
+      /// Set @p op to a random instance of its @p which alternative
+      void fill_operation( operation& op, int64_t which )
+      {
+         op.set_which( which );
+         op.visit( alternative_filler{ *this } );
+      }
+
+      template<typename T>
+      typename std::enable_if<std::is_integral<T>::value>::type fill( T& v ) { v = static_cast<T>( _rng() ); }
+      void fill( bool& v ) { v = ( _rng() & 1 ) != 0; }
+      /// Enums are written by name in JSON, only the first value is known to be valid
+      template<typename T>
+      typename std::enable_if<std::is_enum<T>::value>::type fill( T& v ) { v = static_cast<T>( 0 ); }
+
+      template<typename T>
+      typename std::enable_if<fc::reflector<T>::is_defined::value && !std::is_enum<T>::value>::type fill( T& v )
+      {
+         fc::reflector<T>::visit( member_filler<T>{ *this, v } );
+      }
+
+      void fill( std::string& v )
+      {
+         static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789-.";
+         v.resize( _rng() % 17 );
+         for( char& c : v )
+            c = chars[ _rng() % ( sizeof(chars) - 1 ) ];
+      }
+      void fill( std::vector<char>& v )
+      {
+         v.resize( _rng() % 33 );
+         fill_bytes( v.data(), v.size() );
+      }
+      void fill( fc::unsigned_int& v ) { v.value = static_cast<uint32_t>( _rng() ); }
+      void fill( fc::time_point_sec& v ) { v = fc::time_point_sec( static_cast<uint32_t>( _rng() % 0x7fffffff ) ); }
+      void fill( fc::sha1& v ) { fill_bytes( v.data(), v.data_size() ); }
+      void fill( fc::sha256& v ) { fill_bytes( v.data(), v.data_size() ); }
+      void fill( fc::ripemd160& v ) { fill_bytes( v.data(), v.data_size() ); }
+      void fill( fc::hash160& v ) { fill_bytes( v.data(), v.data_size() ); }
+      void fill( fc::ecc::commitment_type& v ) { fill_bytes( reinterpret_cast<char*>( &v ), sizeof(v) ); }
+      /// Keys are taken from a few valid keys, random bytes are not always on the curve
+      void fill( fc::ecc::public_key& v ) { v = _keys[ _rng() % _keys.size() ]; }
+      void fill( public_key_type& v ) { v = _keys[ _rng() % _keys.size() ]; }
+      void fill( vote_id_type& v )
+      {
+         v = vote_id_type( vote_id_type::vote_type( _rng() % vote_id_type::VOTE_TYPE_COUNT ),
+                           static_cast<uint32_t>( _rng() & 0xffffff ) );
+      }
+      void fill( object_id_type& v ) { v = object_id_type( 1, _rng() % 20, _rng() & 0xffffff ); }
+      template<uint8_t SpaceID, uint8_t TypeID>
+      void fill( object_id<SpaceID,TypeID>& v ) { v = object_id<SpaceID,TypeID>( _rng() & 0xffffff ); }
+
+      template<typename T>
+      void fill( fc::safe<T>& v ) { fill( v.value ); }
+      template<typename T>
+      void fill( fc::extension<T>& v ) { fill( v.value ); }
+      template<typename T>
+      void fill( std::shared_ptr<const T>& v )
+      {
+         auto value = std::make_shared<T>();
+         fill( *value );
+         v = value;
+      }
+      template<typename A, typename B>
+      void fill( std::pair<A,B>& v )
+      {
+         fill( v.first );
+         fill( v.second );
+      }
+      template<typename T, size_t N>
+      void fill( std::array<T,N>& v )
+      {
+         for( T& e : v )
+            fill( e );
+      }
+      template<typename T>
+      void fill( fc::optional<T>& v )
+      {
+         v.reset();
+         if( _depth >= max_depth || ( _rng() & 1 ) == 0 )
+            return;
+         ++_depth;
+         T value;
+         fill( value );
+         v = value;
+         --_depth;
+      }
+      template<typename T>
+      void fill( std::vector<T>& v )
+      {
+         v.resize( random_size() );
+         ++_depth;
+         for( T& e : v )
+            fill( e );
+         --_depth;
+      }
+      template<typename T, typename... Rest>
+      void fill( boost::container::flat_set<T,Rest...>& v ) { fill_set( v ); }
+      template<typename T, typename... Rest>
+      void fill( std::set<T,Rest...>& v ) { fill_set( v ); }
+      template<typename K, typename V, typename... Rest>
+      void fill( boost::container::flat_map<K,V,Rest...>& v ) { fill_map( v ); }
+      template<typename K, typename V, typename... Rest>
+      void fill( std::map<K,V,Rest...>& v ) { fill_map( v ); }
+      template<typename... T>
+      void fill( fc::static_variant<T...>& v )
+      {
+         v.set_which( _rng() % v.count() );
+         v.visit( alternative_filler{ *this } );
+      }
+
+   private:
+      template<typename Class>
+      struct member_filler
+      {
+         random_generator& gen;
+         Class& obj;
+
+         template<typename Member, class C, Member (C::*member)>
+         void operator()( const char* )const { gen.fill( obj.*member ); }
+      };
+
+      struct alternative_filler
+      {
+         typedef void result_type;
+         random_generator& gen;
+
+         template<typename T>
+         void operator()( T& alternative )const { gen.fill( alternative ); }
+      };
+
+      size_t random_size() { return _depth >= max_depth ? 0 : _rng() % ( max_elements + 1 ); }
+
+      void fill_bytes( char* data, size_t size )
+      {
+         for( size_t i = 0; i < size; ++i )
+            data[i] = static_cast<char>( _rng() );
+      }
+
+      template<typename Set>
+      void fill_set( Set& v )
+      {
+         v.clear();
+         const size_t size = random_size();
+         ++_depth;
+         for( size_t i = 0; i < size; ++i )
+         {
+            typename Set::value_type e;
+            fill( e );
+            v.insert( std::move(e) );
+         }
+         --_depth;
+      }
+
+      template<typename Map>
+      void fill_map( Map& v )
+      {
+         v.clear();
+         const size_t size = random_size();
+         ++_depth;
+         for( size_t i = 0; i < size; ++i )
+         {
+            typename Map::key_type k;
+            typename Map::mapped_type m;
+            fill( k );
+            fill( m );
+            v[k] = std::move(m);
+         }
+         --_depth;
+      }
+
+      std::mt19937_64                   _rng;
+      std::vector<fc::ecc::public_key>  _keys;
+      uint32_t                          _depth = 0;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( serialization_benchmarks )
+
+/// Binary and JSON serialization of @a scale random instances of each operation type
+BOOST_AUTO_TEST_CASE( operation_serialization )
+{ try {
+   const auto& config = benchmark_config::get();
+   operation prototype;
+   for( int64_t which = 0; which < prototype.count(); ++which )
+   {
+      random_generator gen( which + 1 );
+      std::vector<operation> ops( config.scale );
+      for( operation& op : ops )
+         gen.fill_operation( op, which );
+      const std::string& name = operation_name( which );
+
+      // Check the round trips once, outside of the measurements
+      std::vector<std::vector<char>> packed;
+      packed.reserve( ops.size() );
+      for( const operation& op : ops )
+      {
+         packed.push_back( fc::raw::pack( op ) );
+         FC_ASSERT( fc::raw::pack( fc::raw::unpack<operation>( packed.back() ) ) == packed.back(),
+                    "Binary round trip of ${n} changed it", ("n",name) );
+         const std::string json = fc::json::to_string( fc::variant( op, GRAPHENE_MAX_NESTED_OBJECTS ) );
+         FC_ASSERT( fc::raw::pack( fc::json::from_string( json ).as<operation>( GRAPHENE_MAX_NESTED_OBJECTS ) )
+                       == packed.back(),
+                    "JSON round trip of ${n} changed it", ("n",name) );
+      }
+
+      run_benchmark( "pack/" + name, 1, [&ops]( uint64_t ) {
+         for( const operation& op : ops )
+            fc::raw::pack( op );
+         return uint64_t( ops.size() );
+      } );
+      run_benchmark( "unpack/" + name, 1, [&packed]( uint64_t ) {
+         for( const std::vector<char>& bytes : packed )
+            fc::raw::unpack<operation>( bytes );
+         return uint64_t( packed.size() );
+      } );
+      run_benchmark( "json/" + name, 1, [&ops]( uint64_t ) {
+         for( const operation& op : ops )
+         {
+            const std::string json = fc::json::to_string( fc::variant( op, GRAPHENE_MAX_NESTED_OBJECTS ) );
+            fc::json::from_string( json ).as<operation>( GRAPHENE_MAX_NESTED_OBJECTS );
+         }
+         return uint64_t( ops.size() );
+      } );
+   }
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1016,6 +1016,64 @@ BOOST_FIXTURE_TEST_CASE(cli_sign_tx_with_unnecessary_signature, cli_fixture) {
 }
 
 
+///////////////////////
+// Wallet RPC
+// Test signing and broadcasting many transactions at once, one of which is rejected
+///////////////////////
+BOOST_FIXTURE_TEST_CASE( cli_sign_transactions, cli_fixture )
+{
+   try
+   {
+      INVOKE(upgrade_nathan_account);
+      auto db = app1->chain_database();
+
+      const account_object nathan_acct = con.wallet_api_ptr->get_account("nathan");
+      const account_object init0_acct = con.wallet_api_ptr->get_account("init0");
+      const share_type init0_balance = db->get_balance( init0_acct.get_id(), asset_id_type() ).amount;
+
+      // the 2nd transfer is more than nathan has
+      vector<signed_transaction> txs( 3 );
+      const vector<share_type> amounts { 1000, GRAPHENE_MAX_SHARE_SUPPLY, 2000 };
+      for( size_t i = 0; i < txs.size(); ++i )
+      {
+         transfer_operation top;
+         top.from = nathan_acct.get_id();
+         top.to = init0_acct.get_id();
+         top.amount = asset( amounts[i] );
+         txs[i].operations.push_back( top );
+      }
+
+      BOOST_TEST_MESSAGE("Signing without broadcast");
+      auto results = con.wallet_api_ptr->sign_transactions( txs, "1.3.0", 0, false );
+      BOOST_REQUIRE_EQUAL( results.size(), txs.size() );
+      for( const auto& result : results )
+      {
+         BOOST_CHECK( !result.accepted );
+         BOOST_CHECK( !result.error.valid() );
+         BOOST_CHECK( con.wallet_api_ptr->get_transaction_signers( result.transaction )
+                      == flat_set<public_key_type>( { nathan_acct.active.get_keys().front() } ) );
+         BOOST_CHECK( result.transaction.operations.front().get<transfer_operation>().fee.amount > 0 );
+      }
+
+      BOOST_TEST_MESSAGE("Signing and broadcasting, the rejected transaction does not stop the others");
+      results = con.wallet_api_ptr->sign_transactions( txs, "1.3.0", 1, true );
+      BOOST_REQUIRE_EQUAL( results.size(), txs.size() );
+      BOOST_CHECK( results[0].accepted );
+      BOOST_CHECK( !results[0].error.valid() );
+      BOOST_CHECK( !results[1].accepted );
+      BOOST_CHECK( results[1].error.valid() );
+      BOOST_CHECK( results[2].accepted );
+      BOOST_CHECK( !results[2].error.valid() );
+
+      BOOST_CHECK( generate_block( app1 ) );
+      BOOST_CHECK_EQUAL( db->get_balance( init0_acct.get_id(), asset_id_type() ).amount.value,
+                         ( init0_balance + amounts[0] + amounts[2] ).value );
+   } catch( fc::exception& e ) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
 ///////////////////////
 // Wallet RPC
 // Test adding an unnecessary signature to a transaction builder
@@ -423,7 +423,7 @@ std::shared_ptr<boost::program_options::variables_map> database_fixture_base::in
       BOOST_TEST_MESSAGE( string("ES index prefix is ") + fixture.es_index_prefix );
       fc::set_option( options, "elasticsearch-index-prefix", fixture.es_index_prefix );
    }
-   else if( fixture.current_suite_name != "performance_tests" )
+   else if( fixture.current_suite_name != "performance_tests" && fixture.with_history_plugins )
    {
       fixture.app.register_plugin<graphene::account_history::account_history_plugin>(true);
    }
@@ -466,8 +466,11 @@ std::shared_ptr<boost::program_options::variables_map> database_fixture_base::in
 
    fc::set_option( options, "bucket-size", string("[15]") );
 
-   fixture.app.register_plugin<graphene::market_history::market_history_plugin>(true);
-   fixture.app.register_plugin<graphene::grouped_orders::grouped_orders_plugin>(true);
+   if( fixture.with_history_plugins )
+   {
+      fixture.app.register_plugin<graphene::market_history::market_history_plugin>(true);
+      fixture.app.register_plugin<graphene::grouped_orders::grouped_orders_plugin>(true);
+   }
 
    return sharable_options;
 }
@@ -223,6 +223,7 @@ struct database_fixture_base {
    bool hf2481 = false;
    bool bsip77 = false;
    bool hf2595 = false;
+   bool with_history_plugins = true; ///< Whether the history plugins are loaded, only benchmarks may go without
 
    string es_index_prefix; ///< Index prefix for elasticsearch plugin
    string es_obj_index_prefix; ///< Index prefix for es_objects plugin
@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <functional>
+#include <random>
+
+#include <fc/io/json.hpp>
+#include <fc/thread/parallel.hpp>
+
+#include <graphene/app/api.hpp>
+#include <graphene/chain/account_object.hpp>
+#include <graphene/chain/asset_object.hpp>
+#include <graphene/chain/balance_object.hpp>
+#include <graphene/chain/config.hpp>
+#include <graphene/chain/market_object.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+using namespace graphene::app;
+using namespace graphene::chain;
+using namespace std;
+namespace bpo = boost::program_options;
+
+// hack:  import create_example_genesis() even though it's a way, way
+// specific internal detail
+namespace graphene { namespace app { namespace detail {
+genesis_state_type create_example_genesis();
+} } } // graphene::app::detail
+
+namespace {
+
+/// Deterministic on every platform, unlike the standard distributions
+class synthetic_random
+{
+public:
+   explicit synthetic_random( uint64_t seed ) : _engine( seed ) {}
+
+   /// Uniform in [0, n)
+   uint64_t below( uint64_t n ) { return _engine() % n; }
+
+   /// Uniform in (0, 1]
+   double unit() { return ( ( _engine() >> 11 ) + 1 ) * ( 1.0 / 9007199254740992.0 ); }
+
+   /// Heavy tailed amount of at least @p base, like balances and trade sizes on a live chain
+   int64_t pareto( int64_t base, int64_t cap, double alpha = 1.5 )
+   {
+      return static_cast<int64_t>( std::min<double>( cap, base / std::pow( unit(), 1.0 / alpha ) ) );
+   }
+
+private:
+   std::mt19937_64 _engine;
+};
+
+struct live_order
+{
+   limit_order_id_type id;
+   account_id_type     owner;
+};
+
+/// Produces blocks of transactions with one operation each, signed in parallel
+class block_producer
+{
+public:
+   using result_handler = std::function<void( const operation_result& )>;
+
+   block_producer( database& db, const fc::ecc::private_key& witness_key, uint32_t ops_per_block )
+      : _db( db ), _witness_key( witness_key ), _ops_per_block( ops_per_block ) {}
+
+   /**
+    * Add an operation signed by @p key, producing a block when it is full.
+    * @p on_result is called with the result of the operation once it is applied, not if it is rejected.
+    */
+   void add( operation op, const fc::ecc::private_key& key, result_handler on_result = result_handler() )
+   {
+      _db.current_fee_schedule().set_fee( op );
+      _pending.push_back( { std::move(op), &key, std::move(on_result) } );
+      if( _pending.size() >= _ops_per_block )
+         flush();
+   }
+
+   /// Put the pending operations into a block
+   void flush()
+   {
+      if( _pending.empty() )
+         return;
+      vector<signed_transaction> trxs( _pending.size() );
+      for( size_t i = 0; i < trxs.size(); ++i )
+      {
+         trxs[i].operations.push_back( std::move( _pending[i].op ) );
+         trxs[i].set_reference_block( _db.head_block_id() );
+         // The reference block differs between blocks and the expiration within a block, so all are unique
+         trxs[i].set_expiration( _db.head_block_time() + 120 + static_cast<uint32_t>( i ) );
+      }
+
+      const size_t chunks = fc::asio::default_io_service_scope::get_num_threads();
+      const size_t chunk_size = ( trxs.size() + chunks - 1 ) / chunks;
+      std::vector<fc::future<void>> workers;
+      const chain_id_type& chain_id = _db.get_chain_id();
+      for( size_t base = 0; base < trxs.size(); base += chunk_size )
+         workers.push_back( fc::do_parallel( [this,&trxs,&chain_id,base,chunk_size] () {
+            const size_t end = std::min( base + chunk_size, trxs.size() );
+            for( size_t i = base; i < end; ++i )
+               trxs[i].sign( *_pending[i].key, chain_id );
+         }) );
+      for( auto& worker : workers )
+         worker.wait();
+
+      for( size_t i = 0; i < trxs.size(); ++i )
+      {
+         try
+         {
+            const auto result = _db.push_transaction( trxs[i], skip ).operation_results.front();
+            ++_operations;
+            if( _pending[i].on_result )
+               _pending[i].on_result( result );
+         }
+         catch( const fc::exception& e )
+         {
+            ++_rejected;
+            wlog( "Rejected synthetic transaction: ${e}", ("e",e.to_string()) );
+         }
+      }
+      _pending.clear();
+      _db.generate_block( _db.get_slot_time(1), _db.get_scheduled_witness(1), _witness_key, skip );
+   }
+
+   uint64_t operations()const { return _operations; }
+   uint64_t rejected()const { return _rejected; }
+
+   /// Signatures are still made, so that the blocks are valid for a node checking them
+   static constexpr uint32_t skip = database::skip_transaction_signatures | database::skip_tapos_check
+                                  | database::skip_witness_signature;
+
+private:
+   struct pending_operation
+   {
+      operation                   op;
+      const fc::ecc::private_key* key;
+      result_handler              on_result;
+   };
+
+   database&                   _db;
+   const fc::ecc::private_key& _witness_key;
+   const uint32_t              _ops_per_block;
+   vector<pending_operation>   _pending;
+   uint64_t                    _operations = 0;
+   uint64_t                    _rejected = 0;
+};
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+   try
+   {
+      bpo::options_description cli_options("Synthetic chain state generator");
+      cli_options.add_options()
+            ("help,h", "Print this help message and exit.")
+            ("data-dir", bpo::value<boost::filesystem::path>()->default_value("synthetic_data_dir"),
+             "Directory to write genesis.json and the blockchain to")
+            ("seed", bpo::value<uint64_t>()->default_value(1), "Seed of the generator, same seed gives the same chain")
+            ("genesis-time", bpo::value<uint32_t>()->default_value(1600000000), "Timestamp of the genesis state")
+            ("accounts", bpo::value<uint32_t>()->default_value(100000), "Number of accounts in the genesis state")
+            ("keys", bpo::value<uint32_t>()->default_value(100), "Number of distinct keys shared by the accounts")
+            ("bitassets", bpo::value<uint32_t>()->default_value(100), "Number of bitassets in the genesis state")
+            ("call-orders", bpo::value<uint32_t>()->default_value(100), "Number of call orders per bitasset")
+            ("uias", bpo::value<uint32_t>()->default_value(1000), "Number of user issued assets created in blocks")
+            ("holders", bpo::value<uint32_t>()->default_value(100), "Number of accounts each user issued asset is issued to")
+            ("orders", bpo::value<uint32_t>()->default_value(100000), "Number of limit orders left on the books")
+            ("mixed-operations", bpo::value<uint32_t>()->default_value(100000),
+             "Number of transfers, order creations and cancellations and account updates after the setup")
+            ("ops-per-block", bpo::value<uint32_t>()->default_value(1000), "Number of operations per block")
+            ("feed-interval", bpo::value<uint32_t>()->default_value(1200),
+             "Number of blocks between price feeds of all bitassets during the mixed operations")
+            ("fee-scale", bpo::value<uint32_t>()->default_value(10),
+             "Scale of the default fees in hundredths of a percent, kept low so that balances last")
+            ;
+
+      bpo::variables_map options;
+      try
+      {
+         bpo::store( bpo::parse_command_line(argc, argv, cli_options), options );
+      }
+      catch (const bpo::error& e)
+      {
+         std::cerr << "generate_synthetic_state:  error parsing command line: " << e.what() << "\n";
+         return 1;
+      }
+
+      if( options.count("help") )
+      {
+         std::cout << cli_options << "\n";
+         return 0;
+      }
+
+      fc::path data_dir = options["data-dir"].as<boost::filesystem::path>();
+      if( data_dir.is_relative() )
+         data_dir = fc::current_path() / data_dir;
+      FC_ASSERT( !fc::exists( data_dir / "blockchain" ), "${d} already holds a blockchain", ("d",data_dir) );
+
+      const uint32_t account_count = options["accounts"].as<uint32_t>();
+      const uint32_t key_count = std::max( 1u, options["keys"].as<uint32_t>() );
+      const uint32_t bitasset_count = options["bitassets"].as<uint32_t>();
+      const uint32_t call_order_count = options["call-orders"].as<uint32_t>();
+      const uint32_t uia_count = options["uias"].as<uint32_t>();
+      const uint32_t holder_count = options["holders"].as<uint32_t>();
+      const uint32_t order_count = options["orders"].as<uint32_t>();
+      const uint32_t mixed_count = options["mixed-operations"].as<uint32_t>();
+      const uint32_t feed_interval = std::max( 1u, options["feed-interval"].as<uint32_t>() );
+      FC_ASSERT( account_count > 1, "At least two accounts are needed" );
+      synthetic_random rng( options["seed"].as<uint64_t>() );
+
+      const fc::ecc::private_key nathan_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("nathan")));
+      vector<fc::ecc::private_key> keys;
+      keys.reserve( key_count );
+      for( uint32_t k = 0; k < key_count; ++k )
+         keys.push_back( fc::ecc::private_key::regenerate( fc::sha256::hash( "synthetic-key-" + fc::to_string(k) ) ) );
+
+      // Genesis: the example genesis, plus accounts and bitassets with their call orders
+      genesis_state_type genesis = graphene::app::detail::create_example_genesis();
+      genesis.initial_timestamp = fc::time_point_sec( options["genesis-time"].as<uint32_t>() );
+      genesis.initial_timestamp -= genesis.initial_timestamp.sec_since_epoch() % genesis.initial_parameters.block_interval;
+      genesis.initial_parameters.get_mutable_fees().scale = options["fee-scale"].as<uint32_t>();
+      genesis.initial_accounts.reserve( genesis.initial_accounts.size() + account_count );
+      for( uint32_t i = 0; i < account_count; ++i )
+         genesis.initial_accounts.emplace_back( "synth" + fc::to_string(i), keys[ i % key_count ].get_public_key() );
+
+      share_type total_collateral = 0;
+      for( uint32_t b = 0; b < bitasset_count; ++b )
+      {
+         genesis_state_type::initial_asset_type bitasset;
+         bitasset.symbol = "SYNBIT" + fc::to_string(b);
+         bitasset.issuer_name = "nathan";
+         bitasset.description = "Synthetic bitasset";
+         bitasset.precision = 4;
+         bitasset.max_supply = GRAPHENE_MAX_SHARE_SUPPLY;
+         bitasset.is_bitasset = true;
+         for( uint32_t c = 0; c < call_order_count; ++c )
+         {
+            const address owner( keys[ ( b * call_order_count + c ) % key_count ].get_public_key() );
+            const share_type collateral = rng.pareto( 1000000, 100000000000LL );
+            // 400% collateralized at the feed price of 1, the debt goes to the borrower
+            bitasset.collateral_records.push_back( { owner, collateral, collateral / 4 } );
+            genesis.initial_balances.push_back( { owner, bitasset.symbol, collateral / 4 } );
+            total_collateral += collateral;
+         }
+         genesis.initial_assets.push_back( std::move(bitasset) );
+      }
+      FC_ASSERT( genesis.initial_balances.front().asset_symbol == GRAPHENE_SYMBOL );
+      genesis.initial_balances.front().amount -= total_collateral;
+
+      fc::create_directories( data_dir );
+      const string genesis_json = fc::json::to_pretty_string( genesis );
+      {
+         std::ofstream out( ( data_dir / "genesis.json" ).string() );
+         out << genesis_json;
+      }
+      // The chain ID a node computes from the file
+      genesis.initial_chain_id = fc::sha256::hash( genesis_json );
+      std::cerr << "generate_synthetic_state:  Wrote genesis with " << account_count << " accounts and "
+                << bitasset_count << " bitassets\n";
+
+      database db;
+      db.open( data_dir / "blockchain", [&genesis]() { return genesis; }, GRAPHENE_CURRENT_DB_VERSION );
+      block_producer producer( db, nathan_key, std::max( 1u, options["ops-per-block"].as<uint32_t>() ) );
+
+      const auto& accounts_by_name = db.get_index_type<account_index>().indices().get<by_name>();
+      const account_id_type nathan_id = accounts_by_name.find( "nathan" )->get_id();
+      const account_id_type init0_id = accounts_by_name.find( "init0" )->get_id();
+      const uint64_t first_account = accounts_by_name.find( "synth0" )->get_id().instance.value;
+      auto account = [first_account]( uint64_t i ) { return account_id_type( first_account + i ); };
+      auto account_key = [&keys,key_count]( uint64_t i ) -> const fc::ecc::private_key& {
+         return keys[ i % key_count ];
+      };
+      vector<asset_id_type> bitassets;
+      for( uint32_t b = 0; b < bitasset_count; ++b )
+         bitassets.push_back( db.get_index_type<asset_index>().indices().get<by_symbol>()
+                                .find( "SYNBIT" + fc::to_string(b) )->get_id() );
+
+      // Claim the stake of nathan
+      {
+         const auto& balances = db.get_index_type<balance_index>().indices().get<by_owner>();
+         const auto itr = balances.find( boost::make_tuple( address( nathan_key.get_public_key() ), asset_id_type() ) );
+         FC_ASSERT( itr != balances.end() );
+         balance_claim_operation claim;
+         claim.deposit_to_account = nathan_id;
+         claim.balance_to_claim = itr->get_id();
+         claim.balance_owner_key = nathan_key.get_public_key();
+         claim.total_claimed = itr->balance;
+         producer.add( claim, nathan_key );
+         producer.flush();
+      }
+
+      // Fund every account, with a total of about a tenth of the stake
+      const int64_t funding = std::min<int64_t>( 1000000000LL,
+            db.get_balance( nathan_id, asset_id_type() ).amount.value / ( 32 * int64_t(account_count) ) );
+      for( uint32_t i = 0; i < account_count; ++i )
+      {
+         transfer_operation op;
+         op.from = nathan_id;
+         op.to = account(i);
+         op.amount = asset( rng.pareto( funding, funding * 64 ) );
+         producer.add( op, nathan_key );
+      }
+      producer.flush();
+      std::cerr << "generate_synthetic_state:  Funded accounts, head block " << db.head_block_num() << "\n";
+
+      // Feeds of the bitassets by a witness
+      auto publish_feeds = [&]( uint32_t round ) {
+         for( const auto& bitasset : bitassets )
+         {
+            asset_publish_feed_operation op;
+            op.publisher = init0_id;
+            op.asset_id = bitasset;
+            op.feed.settlement_price = asset( 10000 + round % 100, bitasset ) / asset( 10000 );
+            op.feed.core_exchange_rate = op.feed.settlement_price;
+            producer.add( op, nathan_key );
+         }
+      };
+      publish_feeds( 0 );
+
+      // User issued assets, each issued to a set of holders
+      vector<asset_id_type> uias;
+      vector<vector<uint32_t>> uia_holders( uia_count );
+      for( uint32_t u = 0; u < uia_count; ++u )
+      {
+         asset_create_operation op;
+         op.issuer = nathan_id;
+         op.symbol = "SYNUIA" + fc::to_string(u);
+         op.precision = 4;
+         op.common_options.max_supply = GRAPHENE_MAX_SHARE_SUPPLY;
+         op.common_options.flags = 0;
+         op.common_options.issuer_permissions = 0;
+         op.common_options.core_exchange_rate = price( asset( 1, asset_id_type(1) ), asset( 1 ) );
+         producer.add( op, nathan_key, [&uias]( const operation_result& result ) {
+            uias.push_back( asset_id_type( result.get<object_id_type>() ) );
+         } );
+      }
+      producer.flush();
+      for( size_t u = 0; u < uias.size(); ++u )
+      {
+         for( uint32_t h = 0; h < holder_count; ++h )
+         {
+            const uint32_t holder = static_cast<uint32_t>( rng.below( account_count ) );
+            asset_issue_operation op;
+            op.issuer = nathan_id;
+            op.asset_to_issue = asset( rng.pareto( 10000000, 10000000000LL ), uias[u] );
+            op.issue_to_account = account( holder );
+            producer.add( op, nathan_key );
+            uia_holders[u].push_back( holder );
+         }
+      }
+      producer.flush();
+      std::cerr << "generate_synthetic_state:  Created " << uias.size() << " user issued assets, head block "
+                << db.head_block_num() << "\n";
+
+      // Limit orders: CORE offered for any asset at 5% to 100% above a price of 1, and user issued assets
+      // offered for CORE likewise, so that nothing matches and all of them stay on the books
+      vector<live_order> orders;
+      auto make_order = [&]() -> std::pair<limit_order_create_operation, uint32_t> {
+         limit_order_create_operation op;
+         op.expiration = fc::time_point_sec::maximum();
+         const int64_t amount = 10 + rng.below( 1000 );
+         const int64_t premium = amount * ( 105 + rng.below( 96 ) ) / 100;
+         uint32_t seller = 0;
+         if( uias.empty() || rng.below( 2 ) == 0 )
+         {
+            const size_t markets = uias.size() + bitassets.size();
+            FC_ASSERT( markets > 0, "Orders need user issued assets or bitassets" );
+            const size_t m = rng.below( markets );
+            seller = static_cast<uint32_t>( rng.below( account_count ) );
+            op.amount_to_sell = asset( amount );
+            op.min_to_receive = asset( premium, m < uias.size() ? uias[m] : bitassets[ m - uias.size() ] );
+         }
+         else
+         {
+            const size_t u = rng.below( uias.size() );
+            seller = uia_holders[u][ rng.below( uia_holders[u].size() ) ];
+            op.amount_to_sell = asset( amount, uias[u] );
+            op.min_to_receive = asset( premium );
+         }
+         op.seller = account( seller );
+         return { op, seller };
+      };
+      auto place_order = [&]() {
+         const auto order = make_order();
+         const account_id_type owner = order.first.seller;
+         producer.add( order.first, account_key( order.second ), [&orders,owner]( const operation_result& result ) {
+            orders.push_back( { limit_order_id_type( result.get<object_id_type>() ), owner } );
+         } );
+      };
+
+      if( !( uias.empty() && bitassets.empty() ) )
+      {
+         for( uint32_t o = 0; o < order_count; ++o )
+            place_order();
+         producer.flush();
+      }
+      std::cerr << "generate_synthetic_state:  Placed " << orders.size() << " limit orders, head block "
+                << db.head_block_num() << "\n";
+
+      // Mixed operations, in proportions similar to those of a live chain
+      const bool has_markets = !( uias.empty() && bitassets.empty() );
+      uint32_t last_feed_block = db.head_block_num();
+      for( uint32_t i = 0; i < mixed_count; ++i )
+      {
+         const uint64_t kind = rng.below( 100 );
+         if( kind < 55 || !has_markets )
+         {
+            const uint32_t from = static_cast<uint32_t>( rng.below( account_count ) );
+            transfer_operation op;
+            op.from = account( from );
+            op.to = account( ( from + 1 + rng.below( account_count - 1 ) ) % account_count );
+            op.amount = asset( 1 + rng.below( 1000 ) );
+            producer.add( op, account_key( from ) );
+         }
+         else if( kind < 80 || ( kind < 95 && orders.empty() ) )
+            place_order();
+         else if( kind < 95 )
+         {
+            const size_t o = rng.below( orders.size() );
+            limit_order_cancel_operation op;
+            op.fee_paying_account = orders[o].owner;
+            op.order = orders[o].id;
+            producer.add( op, account_key( orders[o].owner.instance.value - first_account ) );
+            orders[o] = orders.back();
+            orders.pop_back();
+         }
+         else
+         {
+            const uint32_t a = static_cast<uint32_t>( rng.below( account_count ) );
+            account_update_operation op;
+            op.account = account( a );
+            op.new_options = account( a )( db ).options;
+            op.new_options->memo_key = keys[ rng.below( key_count ) ].get_public_key();
+            producer.add( op, account_key( a ) );
+         }
+
+         if( db.head_block_num() - last_feed_block >= feed_interval )
+         {
+            publish_feeds( db.head_block_num() );
+            last_feed_block = db.head_block_num();
+         }
+      }
+      producer.flush();
+
+      std::cerr << "generate_synthetic_state:  Done, " << db.head_block_num() << " blocks with "
+                << producer.operations() << " operations, " << producer.rejected() << " rejected, "
+                << orders.size() << " limit orders left\n"
+                << "Replay with: witness_node --data-dir " << data_dir.generic_string()
+                << " --genesis-json " << ( data_dir / "genesis.json" ).generic_string() << " --replay-blockchain\n";
+      db.close();
+   }
+   catch ( const fc::exception& e )
+   {
+      std::cout << e.to_detail_string() << "\n";
+      return 1;
+   }
+   return 0;
+}
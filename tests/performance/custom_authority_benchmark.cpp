@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/protocol/restriction_predicate.hpp>
+
+#include <fc/time.hpp>
+#include <fc/log/logger.hpp>
+
+#include <algorithm>
+
+using namespace graphene::protocol;
+
+namespace {
+
+#define FUNC(TYPE) BOOST_PP_CAT(restriction::func_, TYPE)
+
+template<typename Object>
+unsigned_int member_index(string name) {
+   unsigned_int index;
+   fc::typelist::runtime::for_each(typename fc::reflector<Object>::native_members(), [&name, &index](auto t) mutable {
+      if (name == decltype(t)::type::get_name())
+         index = decltype(t)::type::index;
+   });
+   return index;
+}
+
+// A predicate built the way restrictions were evaluated before they were compiled: one closure per restriction list,
+// per logical OR, per member access and per comparison
+template<typename Object>
+using reference_predicate = std::function<predicate_result(const Object&)>;
+
+template<typename Object>
+reference_predicate<Object> reference_all_of(vector<reference_predicate<Object>> predicates) {
+   return [predicates](const Object& obj) {
+      for (size_t i = 0; i < predicates.size(); ++i) {
+         auto result = predicates[i](obj);
+         if (!result) {
+            result.rejection_path.push_back(i);
+            return result;
+         }
+      }
+      return predicate_result::Success();
+   };
+}
+template<typename Object>
+reference_predicate<Object> reference_any_of(vector<reference_predicate<Object>> predicates) {
+   return [predicates](const Object& obj) {
+      vector<predicate_result> rejections;
+      for (const auto& p : predicates) {
+         auto result = p(obj);
+         if (result)
+            return predicate_result::Success();
+         rejections.push_back(std::move(result));
+      }
+      return predicate_result::Rejection(std::move(rejections));
+   };
+}
+template<typename Object, typename Field>
+reference_predicate<Object> reference_field(Field Object::* member, reference_predicate<Field> p) {
+   return [member, p](const Object& obj) { return p(obj.*member); };
+}
+template<typename Field, typename Check>
+reference_predicate<Field> reference_check(Check check) {
+   return [check](const Field& f) {
+      if (check(f)) return predicate_result::Success();
+      return predicate_result::Rejection(predicate_result::predicate_was_false);
+   };
+}
+template<typename Op>
+restriction_predicate_function reference_operation(reference_predicate<Op> p) {
+   restriction_predicate_function f = [p](const operation& op) {
+      FC_ASSERT(op.which() == operation::tag<Op>::value,
+                "Supplied operation is incorrect type for restriction predicate");
+      return p(op.get<Op>());
+   };
+   return [f](const operation& op) { return f(op).reverse_path(); };
+}
+
+struct restriction_benchmark_case {
+   string                          name;
+   restriction_predicate_function  compiled;
+   restriction_predicate_function  reference;
+   vector<operation>               ops;
+};
+
+restriction_benchmark_case transfer_case() {
+   restriction_benchmark_case c;
+   c.name = "transfer to whitelisted accounts with an amount limit";
+
+   flat_set<account_id_type> recipients;
+   for (uint64_t i = 10; i < 30; ++i)
+      recipients.insert(account_id_type(i));
+   const auto amount_index = member_index<asset>("amount");
+   const auto asset_id_index = member_index<asset>("asset_id");
+
+   vector<restriction> rs = {
+      restriction(member_index<transfer_operation>("to"), FUNC(in), recipients),
+      restriction(member_index<transfer_operation>("amount"), FUNC(attr), vector<restriction>{
+         restriction(amount_index, FUNC(le), int64_t(1000000)),
+         restriction(asset_id_index, FUNC(eq), asset_id_type(0))}),
+      restriction(member_index<transfer_operation>("fee"), FUNC(attr), vector<restriction>{
+         restriction(asset_id_index, FUNC(eq), asset_id_type(0))})
+   };
+   c.compiled = get_restriction_predicate(rs, operation::tag<transfer_operation>::value);
+
+   c.reference = reference_operation<transfer_operation>(reference_all_of<transfer_operation>({
+      reference_field(&transfer_operation::to, reference_check<account_id_type>(
+         [recipients](const account_id_type& to) { return recipients.count(to) != 0; })),
+      reference_field(&transfer_operation::amount, reference_all_of<asset>({
+         reference_field(&asset::amount, reference_check<share_type>(
+            [](const share_type& a) { return a.value <= 1000000; })),
+         reference_field(&asset::asset_id, reference_check<asset_id_type>(
+            [](const asset_id_type& id) { return id == asset_id_type(0); }))})),
+      reference_field(&transfer_operation::fee, reference_all_of<asset>({
+         reference_field(&asset::asset_id, reference_check<asset_id_type>(
+            [](const asset_id_type& id) { return id == asset_id_type(0); }))}))
+   }));
+
+   transfer_operation op;
+   for (uint64_t i = 0; i < 1000; ++i) {
+      op.to = account_id_type(5 + i % 30);
+      op.amount = asset(i * 1500);
+      c.ops.push_back(op);
+   }
+   return c;
+}
+
+restriction_benchmark_case limit_order_case() {
+   restriction_benchmark_case c;
+   c.name = "limit orders trading one asset for a set of others, in either direction";
+
+   const flat_set<asset_id_type> acoins = { asset_id_type(1) };
+   const flat_set<asset_id_type> bcoins = { asset_id_type(2), asset_id_type(3), asset_id_type(4) };
+   const auto sell_index = member_index<limit_order_create_operation>("amount_to_sell");
+   const auto receive_index = member_index<limit_order_create_operation>("min_to_receive");
+   const auto asset_id_index = member_index<asset>("asset_id");
+
+   auto is_in = [asset_id_index](const flat_set<asset_id_type>& ids) {
+      return vector<restriction>{ restriction(asset_id_index, FUNC(in), ids) };
+   };
+   vector<restriction> a_for_b = { restriction(sell_index, FUNC(attr), is_in(acoins)),
+                                   restriction(receive_index, FUNC(attr), is_in(bcoins)) };
+   vector<restriction> b_for_a = { restriction(sell_index, FUNC(attr), is_in(bcoins)),
+                                   restriction(receive_index, FUNC(attr), is_in(acoins)) };
+   vector<restriction> rs = { restriction(unsigned_int(999), FUNC(logical_or),
+                                          vector<vector<restriction>>{ a_for_b, b_for_a }) };
+   c.compiled = get_restriction_predicate(rs, operation::tag<limit_order_create_operation>::value);
+
+   auto ref_is_in = [](const flat_set<asset_id_type>& ids) {
+      return reference_all_of<asset>({ reference_field(&asset::asset_id, reference_check<asset_id_type>(
+         [ids](const asset_id_type& id) { return ids.count(id) != 0; })) });
+   };
+   using lo = limit_order_create_operation;
+   c.reference = reference_operation<lo>(reference_all_of<lo>({ reference_any_of<lo>({
+      reference_all_of<lo>({ reference_field(&lo::amount_to_sell, ref_is_in(acoins)),
+                             reference_field(&lo::min_to_receive, ref_is_in(bcoins)) }),
+      reference_all_of<lo>({ reference_field(&lo::amount_to_sell, ref_is_in(bcoins)),
+                             reference_field(&lo::min_to_receive, ref_is_in(acoins)) }) }) }));
+
+   lo op;
+   for (uint64_t i = 0; i < 1000; ++i) {
+      op.amount_to_sell = asset(100, asset_id_type(i % 5));
+      op.min_to_receive = asset(100, asset_id_type((i / 5) % 5));
+      c.ops.push_back(op);
+   }
+   return c;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( custom_authority_benchmarks )
+
+BOOST_AUTO_TEST_CASE( restriction_evaluation_benchmark )
+{ try {
+   const uint32_t rounds = 200;
+
+   for (const auto& c : { transfer_case(), limit_order_case() }) {
+      uint64_t passed = 0;
+      for (const auto& op : c.ops) {
+         auto compiled = c.compiled(op);
+         auto reference = c.reference(op);
+         BOOST_CHECK_EQUAL(compiled.success, reference.success);
+         BOOST_CHECK_EQUAL(compiled.rejection_path.size(), reference.rejection_path.size());
+         if (compiled.success)
+            ++passed;
+      }
+      BOOST_CHECK(passed > 0 && passed < c.ops.size());
+
+      auto run = [&c, rounds](const restriction_predicate_function& predicate) {
+         uint64_t successes = 0;
+         auto start = fc::time_point::now();
+         for (uint32_t r = 0; r < rounds; ++r)
+            for (const auto& op : c.ops)
+               successes += predicate(op).success;
+         auto elapsed = (fc::time_point::now() - start).count();
+         BOOST_CHECK(successes > 0);
+         return std::max<int64_t>(elapsed, 1);
+      };
+      const int64_t reference_time = run(c.reference);
+      const int64_t compiled_time = run(c.compiled);
+      const uint64_t checks = uint64_t(rounds) * c.ops.size();
+
+      wlog("Restrictions '${n}': ${r} checks/s with nested closures, ${c} checks/s compiled",
+           ("n",c.name)("r",checks*1000000/reference_time)("c",checks*1000000/compiled_time));
+   }
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 contributors.
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/protocol/fee_schedule.hpp>
+#include <graphene/protocol/transaction.hpp>
+
+#include <fc/time.hpp>
+#include <fc/log/logger.hpp>
+
+#include <algorithm>
+
+using namespace graphene::protocol;
+
+namespace {
+
+// How fee parameters were found before they were looked up by tag
+template<typename Operation>
+fee_parameters::flat_set_type::const_iterator find_by_value( const fee_parameters::flat_set_type& parameters )
+{
+   return parameters.find( typename Operation::fee_params_t() );
+}
+
+precomputable_transaction make_transaction()
+{
+   precomputable_transaction trx;
+   for( uint32_t i = 0; i < 10; ++i )
+   {
+      transfer_operation top;
+      top.from = account_id_type(i);
+      top.to = account_id_type(i + 1);
+      top.amount = asset(1000 + i);
+      trx.operations.push_back( top );
+
+      account_update_operation uop;
+      uop.account = account_id_type(i);
+      uop.new_options = account_options();
+      uop.new_options->votes.insert( vote_id_type( "1:" + std::to_string(i) ) );
+      trx.operations.push_back( uop );
+
+      custom_operation cop;
+      cop.payer = account_id_type(i);
+      cop.data.resize( 200 + 100 * i );
+      trx.operations.push_back( cop );
+
+      proposal_create_operation pop;
+      pop.fee_paying_account = account_id_type(i);
+      pop.proposed_ops.emplace_back( top );
+      pop.proposed_ops.emplace_back( cop );
+      trx.operations.push_back( pop );
+   }
+   return trx;
+}
+
+int64_t elapsed_since( const fc::time_point& start )
+{
+   return std::max<int64_t>( (fc::time_point::now() - start).count(), 1 );
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( fee_schedule_benchmarks )
+
+BOOST_AUTO_TEST_CASE( fee_parameters_lookup_benchmark )
+{ try {
+   const fee_schedule& schedule = fee_schedule::get_default();
+   const uint32_t rounds = 1000000;
+
+   auto run = [&schedule, rounds]( auto&& find ) {
+      uint64_t found = 0;
+      auto start = fc::time_point::now();
+      for( uint32_t r = 0; r < rounds; ++r )
+      {
+         found += ( find( schedule.parameters, transfer_operation() ) != schedule.parameters.end() );
+         found += ( find( schedule.parameters, custom_operation() ) != schedule.parameters.end() );
+         found += ( find( schedule.parameters, credit_offer_update_operation() ) != schedule.parameters.end() );
+      }
+      auto elapsed = elapsed_since( start );
+      BOOST_CHECK_EQUAL( found, uint64_t(rounds) * 3 );
+      return elapsed;
+   };
+   const int64_t value_time = run( []( const fee_parameters::flat_set_type& p, const auto& op ) {
+      return find_by_value<std::decay_t<decltype(op)>>( p );
+   } );
+   const int64_t tag_time = run( []( const fee_parameters::flat_set_type& p, const auto& op ) {
+      return find_fee_parameters<std::decay_t<decltype(op)>>( p );
+   } );
+   const uint64_t lookups = uint64_t(rounds) * 3;
+
+   wlog( "Fee parameters: ${v} lookups/s by value, ${t} lookups/s by tag",
+         ("v",lookups*1000000/value_time)("t",lookups*1000000/tag_time) );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( transaction_fee_benchmark )
+{ try {
+   const fee_schedule& schedule = fee_schedule::get_default();
+   const precomputable_transaction trx = make_transaction();
+   const uint32_t rounds = 2000;
+
+   for( size_t i = 0; i < trx.operations.size(); ++i )
+      BOOST_CHECK_EQUAL( schedule.calculate_fee( trx.operations[i], trx.get_operation_packed_size(i) ).amount.value,
+                         schedule.calculate_fee( trx.operations[i] ).amount.value );
+
+   auto run = [&trx, rounds]( auto&& calculate ) {
+      share_type total = 0;
+      auto start = fc::time_point::now();
+      for( uint32_t r = 0; r < rounds; ++r )
+         for( size_t i = 0; i < trx.operations.size(); ++i )
+            total += calculate( i );
+      auto elapsed = elapsed_since( start );
+      BOOST_CHECK( total > 0 );
+      return elapsed;
+   };
+   const int64_t packing_time = run( [&schedule, &trx]( size_t i ) {
+      return schedule.calculate_fee( trx.operations[i] ).amount;
+   } );
+   const int64_t cached_time = run( [&schedule, &trx]( size_t i ) {
+      return schedule.calculate_fee( trx.operations[i], trx.get_operation_packed_size(i) ).amount;
+   } );
+   const uint64_t fees = uint64_t(rounds) * trx.operations.size();
+
+   wlog( "Operation fees: ${p} fees/s packing the operations, ${c} fees/s with cached packed sizes",
+         ("p",fees*1000000/packing_time)("c",fees*1000000/cached_time) );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_SUITE_END()
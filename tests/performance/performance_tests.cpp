@@ -201,6 +201,61 @@ BOOST_AUTO_TEST_CASE( one_hundred_k_benchmark )
       trx.clear();
    }
 
+   std::vector<limit_order_id_type> orders;
+   orders.reserve( cycles );
+
+   {
+      limit_order_create_operation loc;
+      loc.min_to_receive = asset( 5 );
+      loc.fee = db.current_fee_schedule().calculate_fee( loc );
+      for( uint32_t i = 0; i < cycles; ++i )
+      {
+         loc.seller = accounts[i+1];
+         loc.amount_to_sell = asset( 5, assets[i] );
+         trx.operations.push_back( loc );
+         ++total_count;
+         transactions[i] = trx;
+         trx.operations.clear();
+      }
+
+      auto start = fc::time_point::now();
+      for( uint32_t i = 0; i < cycles; ++i )
+      {
+         auto result = db.apply_transaction( transactions[i], ~0 );
+         orders.push_back( limit_order_id_type( result.operation_results[0].get<object_id_type>() ) );
+      }
+      auto end = fc::time_point::now();
+      auto elapsed = end - start;
+      total_time += elapsed.count();
+      wlog( "${aps} limit order creations/s over ${total}ms",
+            ("aps",(cycles*1000000)/elapsed.count())("total",elapsed.count()/1000) );
+      trx.clear();
+   }
+
+   {
+      limit_order_cancel_operation lco;
+      lco.fee = db.current_fee_schedule().calculate_fee( lco );
+      for( uint32_t i = 0; i < cycles; ++i )
+      {
+         lco.fee_paying_account = accounts[i+1];
+         lco.order = orders[i];
+         trx.operations.push_back( lco );
+         ++total_count;
+         transactions[i] = trx;
+         trx.operations.clear();
+      }
+
+      auto start = fc::time_point::now();
+      for( uint32_t i = 0; i < cycles; ++i )
+         db.apply_transaction( transactions[i], ~0 );
+      auto end = fc::time_point::now();
+      auto elapsed = end - start;
+      total_time += elapsed.count();
+      wlog( "${aps} limit order cancellations/s over ${total}ms",
+            ("aps",(cycles*1000000)/elapsed.count())("total",elapsed.count()/1000) );
+      trx.clear();
+   }
+
    wlog( "${total} operations in ${total_time}ms => ${avg} ops/s on average",
          ("total",total_count)("total_time",total_time/1000)
          ("avg",(total_count*1000000)/total_time) );
@@ -208,4 +263,79 @@ BOOST_AUTO_TEST_CASE( one_hundred_k_benchmark )
    db._undo_db.enable();
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( merkle_root_benchmark )
+{ try {
+   const uint32_t num_tx = 20000;
+   const uint32_t rounds = 10;
+
+   auto make_block = [num_tx]() {
+      signed_block block;
+      block.transactions.reserve( num_tx );
+      transfer_operation op;
+      op.from = account_id_type(1);
+      op.to = account_id_type(2);
+      for( uint32_t i = 0; i < num_tx; ++i )
+      {
+         op.amount = asset( i + 1 );
+         processed_transaction trx;
+         trx.ref_block_prefix = i;
+         trx.operations.push_back( op );
+         trx.operation_results.push_back( void_result() );
+         block.transactions.push_back( trx );
+      }
+      return block;
+   };
+
+   // the original algorithm: repack each transaction and each pair of digests, serially
+   auto reference_root = []( const signed_block& block ) {
+      vector<digest_type> ids;
+      for( const auto& trx : block.transactions )
+      {
+         digest_type::encoder enc;
+         fc::raw::pack( enc, trx );
+         ids.push_back( enc.result() );
+      }
+      size_t n = ids.size();
+      while( n > 1 )
+      {
+         size_t k = 0;
+         for( size_t i = 0; i + 1 < n; i += 2 )
+            ids[k++] = digest_type::hash( std::make_pair( ids[i], ids[i+1] ) );
+         if( n & 1 )
+            ids[k++] = ids[n-1];
+         n = k;
+      }
+      return checksum_type::hash( ids[0] );
+   };
+
+   const uint32_t skip = database::skip_transaction_signatures | database::skip_witness_signature
+                         | database::skip_transaction_dupe_check | database::skip_block_size_check;
+
+   uint64_t reference_time = 0;
+   uint64_t serial_time = 0;
+   uint64_t parallel_time = 0;
+   for( uint32_t r = 0; r < rounds; ++r )
+   {
+      const signed_block block1 = make_block();
+      const signed_block block2 = make_block();
+      const signed_block block3 = make_block();
+
+      auto start = fc::time_point::now();
+      const checksum_type expected = reference_root( block1 );
+      reference_time += ( fc::time_point::now() - start ).count();
+
+      start = fc::time_point::now();
+      BOOST_CHECK( block2.calculate_merkle_root() == expected );
+      serial_time += ( fc::time_point::now() - start ).count();
+
+      start = fc::time_point::now();
+      db.precompute_parallel( block3, skip ).wait();
+      parallel_time += ( fc::time_point::now() - start ).count();
+      BOOST_CHECK( block3.calculate_merkle_root() == expected );
+   }
+
+   wlog( "Merkle root of ${n} transactions: ${r}us original, ${s}us serial, ${p}us in precompute_parallel",
+         ("n",num_tx)("r",reference_time/rounds)("s",serial_time/rounds)("p",parallel_time/rounds) );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2334,6 +2334,73 @@ BOOST_AUTO_TEST_CASE( irrelevant_signatures )
    PUSH_TX( db, trx );
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( authority_satisfaction_cache_test )
+{ try {
+   ACTORS( (alice)(bob) );
+   fund( alice );
+
+   const fc::ecc::private_key key1 = generate_private_key( "cache-key-1" );
+   const fc::ecc::private_key key2 = generate_private_key( "cache-key-2" );
+   const fc::ecc::private_key key3 = generate_private_key( "cache-key-3" );
+   const public_key_type pub1( key1.get_public_key() );
+   const public_key_type pub2( key2.get_public_key() );
+   const public_key_type pub3( key3.get_public_key() );
+
+   account_update_operation auo;
+   auo.account = alice_id;
+   auo.active = authority( 2, pub1, 1, pub2, 1, pub3, 1 );
+
+   trx.clear();
+   set_expiration( db, trx );
+   trx.operations.push_back( auo );
+   sign( trx, alice_private_key );
+   PUSH_TX( db, trx );
+   trx.clear();
+
+   const auto push_transfer = [&]( const vector<fc::ecc::private_key>& keys, int64_t amount ) {
+      transfer_operation to;
+      to.amount = asset( amount );
+      to.from = alice_id;
+      to.to = bob_id;
+      trx.clear();
+      set_expiration( db, trx );
+      trx.operations.push_back( to );
+      for( const auto& key : keys )
+         sign( trx, key );
+      PUSH_TX( db, trx );
+   };
+
+   // The same set of keys is checked repeatedly, the results must not change when they come from the cache
+   for( int64_t i = 1; i <= 3; ++i )
+   {
+      push_transfer( { key1, key2 }, i );
+      GRAPHENE_REQUIRE_THROW( push_transfer( { key1 }, 100 + i ), tx_missing_active_auth );
+      GRAPHENE_REQUIRE_THROW( push_transfer( { key1, key2, key3 }, 200 + i ), tx_irrelevant_sig );
+   }
+   BOOST_CHECK_EQUAL( get_balance( bob_id, asset_id_type() ), 6 );
+
+   generate_block();
+
+   push_transfer( { key2, key3 }, 10 );
+
+   // Changing the authority invalidates the cached results
+   auo.active = authority( 1, pub3, 1 );
+   trx.clear();
+   set_expiration( db, trx );
+   trx.operations.push_back( auo );
+   sign( trx, key1 );
+   sign( trx, key2 );
+   PUSH_TX( db, trx );
+
+   GRAPHENE_REQUIRE_THROW( push_transfer( { key2, key3 }, 20 ), tx_irrelevant_sig );
+   GRAPHENE_REQUIRE_THROW( push_transfer( { key1, key2 }, 30 ), tx_missing_active_auth );
+   push_transfer( { key3 }, 40 );
+   BOOST_CHECK_EQUAL( get_balance( bob_id, asset_id_type() ), 56 );
+
+   generate_block();
+   BOOST_CHECK_EQUAL( get_balance( bob_id, asset_id_type() ), 56 );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_CASE( self_approving_proposal )
 { try {
    ACTORS( (alice) );
@@ -29,6 +29,7 @@
 #include <graphene/chain/account_object.hpp>
 #include <graphene/chain/asset_object.hpp>
 #include <graphene/chain/exceptions.hpp>
+#include <graphene/protocol/pts_address.hpp>
 
 #include <graphene/db/simple_index.hpp>
 
@@ -472,6 +473,89 @@ BOOST_AUTO_TEST_CASE( memo_test )
    BOOST_CHECK_EQUAL(m.get_message(receiver, sender.get_public_key()), "Hello, world!");
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( key_addresses_test )
+{ try {
+   const public_key_type alice_key = generate_private_key("alice").get_public_key();
+   const public_key_type bob_key = generate_private_key("bob").get_public_key();
+
+   for( int i = 0; i < 2; ++i ) // the 2nd round is served from the cache
+   {
+      const key_addresses addrs = get_key_addresses( alice_key );
+      BOOST_CHECK( addrs[0] == address( pts_address( alice_key, false, 56 ) ) );
+      BOOST_CHECK( addrs[1] == address( pts_address( alice_key, true, 56 ) ) );
+      BOOST_CHECK( addrs[2] == address( pts_address( alice_key, false, 0 ) ) );
+      BOOST_CHECK( addrs[3] == address( pts_address( alice_key, true, 0 ) ) );
+      BOOST_CHECK( addrs[4] == address( alice_key ) );
+   }
+
+   // an account whose active authority only contains an address
+   authority auth;
+   auth.weight_threshold = 1;
+   auth.address_auths[ address( pts_address( alice_key, false, 0 ) ) ] = 1;
+   auto get_active = [&auth]( account_id_type ) { return &auth; };
+   auto get_owner = []( account_id_type ) -> const authority* { return nullptr; };
+   auto get_custom = []( account_id_type, const operation&, rejected_predicate_map* ) {
+      return vector<authority>();
+   };
+
+   transfer_operation op;
+   op.from = account_id_type(5);
+   op.to = account_id_type(6);
+   op.amount = asset(1);
+   const vector<operation> ops { op };
+
+   graphene::protocol::verify_authority( ops, { alice_key }, get_active, get_owner, get_custom, false, true );
+   GRAPHENE_REQUIRE_THROW(
+      graphene::protocol::verify_authority( ops, { bob_key }, get_active, get_owner, get_custom, false, true ),
+      tx_missing_active_auth );
+
+   signed_transaction trx;
+   trx.operations = ops;
+   const auto required = trx.get_required_signatures( db.get_chain_id(), { alice_key, bob_key },
+                                                      get_active, get_owner, false, true );
+   BOOST_REQUIRE_EQUAL( required.size(), 1u );
+   BOOST_CHECK( *required.begin() == alice_key );
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE( unmatched_address_auth_test )
+{ try {
+   const public_key_type alice_key = generate_private_key("alice").get_public_key();
+   const public_key_type bob_key = generate_private_key("bob").get_public_key();
+
+   // the address of bob is never matched, while the key of alice is provided and used
+   authority auth;
+   auth.weight_threshold = 2;
+   auth.key_auths[ alice_key ] = 1;
+   auth.address_auths[ address( pts_address( bob_key, false, 56 ) ) ] = 1;
+   auto get_active = [&auth]( account_id_type ) { return &auth; };
+   auto get_owner = []( account_id_type ) -> const authority* { return nullptr; };
+   auto get_custom = []( account_id_type, const operation&, rejected_predicate_map* ) {
+      return vector<authority>();
+   };
+
+   transfer_operation op;
+   op.from = account_id_type(5);
+   op.to = account_id_type(6);
+   op.amount = asset(1);
+   const vector<operation> ops { op };
+
+   GRAPHENE_REQUIRE_THROW(
+      graphene::protocol::verify_authority( ops, { alice_key }, get_active, get_owner, get_custom, false, true ),
+      tx_missing_active_auth );
+   graphene::protocol::verify_authority( ops, { alice_key, bob_key }, get_active, get_owner, get_custom,
+                                         false, true );
+
+   signed_transaction trx;
+   trx.operations = ops;
+   const auto required = trx.get_required_signatures( db.get_chain_id(), { alice_key },
+                                                      get_active, get_owner, false, true );
+   BOOST_REQUIRE_EQUAL( required.size(), 1u );
+   BOOST_CHECK( *required.begin() == alice_key );
+   const auto both = trx.get_required_signatures( db.get_chain_id(), { alice_key, bob_key },
+                                                  get_active, get_owner, false, true );
+   BOOST_CHECK_EQUAL( both.size(), 2u );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_CASE( exceptions )
 {
    GRAPHENE_CHECK_THROW(FC_THROW_EXCEPTION(balance_claim_invalid_claim_amount, "Etc"), balance_claim_invalid_claim_amount);
@@ -694,6 +778,38 @@ BOOST_AUTO_TEST_CASE( merkle_root )
    BOOST_CHECK( block.calculate_merkle_root() == c(dO) );
 }
 
+BOOST_AUTO_TEST_CASE( merkle_digest_cache_test )
+{ try {
+   auto packed_digest = []( const processed_transaction& trx ) {
+      digest_type::encoder enc;
+      fc::raw::pack( enc, trx );
+      return enc.result();
+   };
+
+   processed_transaction trx;
+   trx.ref_block_prefix = 1;
+   trx.operation_results.emplace_back( void_result() );
+   const digest_type original = trx.merkle_digest();
+   BOOST_CHECK( original == packed_digest( trx ) );
+
+   // a copy with other results, like the copy of a block being applied
+   processed_transaction copy( trx );
+   copy.operation_results[0] = object_id_type( account_id_type(7) );
+   BOOST_CHECK( copy.merkle_digest() == packed_digest( copy ) );
+   BOOST_CHECK( copy.merkle_digest() != original );
+   BOOST_CHECK( trx.merkle_digest() == original );
+
+   processed_transaction assigned;
+   assigned.merkle_digest();
+   assigned = trx;
+   assigned.operation_results.clear();
+   BOOST_CHECK( assigned.merkle_digest() == packed_digest( assigned ) );
+
+   trx.set_operation_results( vector<operation_result>() );
+   BOOST_CHECK( trx.merkle_digest() == packed_digest( trx ) );
+   BOOST_CHECK( trx.merkle_digest() != original );
+} FC_LOG_AND_RETHROW() }
+
 /**
  * Reproduces https://github.com/bitshares/bitshares-core/issues/888 and tests fix for it.
  */
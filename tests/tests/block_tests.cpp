@@ -31,15 +31,18 @@
 #include <graphene/chain/asset_object.hpp>
 #include <graphene/chain/committee_member_object.hpp>
 #include <graphene/chain/proposal_object.hpp>
+#include <graphene/chain/replay_profiler.hpp>
 #include <graphene/chain/market_object.hpp>
 #include <graphene/chain/hardfork.hpp>
 #include <graphene/chain/witness_schedule_object.hpp>
+#include <graphene/chain/transaction_evaluation_state.hpp>
 #include <graphene/chain/witness_object.hpp>
 
 #include <graphene/utilities/tempdir.hpp>
 
 #include <fc/crypto/digest.hpp>
 #include <fc/io/fstream.hpp>
+#include <fc/io/json.hpp>
 
 #include "../common/database_fixture.hpp"
 
@@ -127,6 +130,405 @@ BOOST_AUTO_TEST_CASE( block_database_test )
          FC_ASSERT( blk->witness == witness_id_type(blk->block_num()) );
       }
 
+      bdb.flush();
+      mapped_block_database mapped( data_dir.path() );
+      BOOST_CHECK_EQUAL( mapped.last_block_num(), 5u );
+      BOOST_CHECK( !mapped.fetch_view( 0 ).valid() );
+      BOOST_CHECK( !mapped.fetch_view( 6 ).valid() );
+      for( uint32_t i = 1; i <= 5; ++i )
+      {
+         auto view = mapped.fetch_view( i );
+         BOOST_REQUIRE( view.valid() );
+         BOOST_CHECK( view->header().id() == bdb.fetch_block_id( i ) );
+         BOOST_CHECK( view->block().witness == witness_id_type( i ) );
+      }
+
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+BOOST_AUTO_TEST_CASE( operation_log_test )
+{
+   try {
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+      auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("null_key")) );
+      uint32_t head_num = 0;
+      {
+         database db;
+         db.enable_operation_log( true );
+         db.open(data_dir.path(), make_genesis, "TEST" );
+         for( uint32_t i = 0; i < 20; ++i )
+            db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key,
+                              database::skip_nothing);
+         head_num = db.head_block_num();
+         db.close();
+      }
+      {
+         operation_log log;
+         log.open( data_dir.path() / "database" / "block_num_to_operations" );
+         BOOST_CHECK_GT( log.first_missing_block_num( head_num ), head_num );
+         BOOST_CHECK( log.fetch( 1 ).valid() );
+         BOOST_CHECK( !log.fetch( head_num + 100 ).valid() );
+
+         operation_log::applied_operations ops( 2 );
+         ops[1] = operation_history_object();
+         ops[1]->block_num = head_num + 2;
+         log.store( head_num + 2, ops );
+         BOOST_CHECK_EQUAL( log.first_missing_block_num( head_num + 2 ), head_num + 1 );
+         auto fetched = log.fetch( head_num + 2 );
+         BOOST_REQUIRE( fetched.valid() );
+         BOOST_REQUIRE_EQUAL( fetched->size(), 2u );
+         BOOST_CHECK( !fetched->front().valid() );
+         BOOST_REQUIRE( fetched->back().valid() );
+         BOOST_CHECK_EQUAL( fetched->back()->block_num, head_num + 2 );
+         log.close();
+      }
+      {
+         database db;
+         db.enable_operation_log( true );
+         db.open(data_dir.path(), []{return genesis_state_type();}, "TEST");
+         uint32_t replayed = 0;
+         db.replay_operation_log( [&db,&replayed]( const signed_block& b ) {
+            BOOST_CHECK_EQUAL( b.block_num(), replayed + 1 );
+            for( const auto& o : db.get_applied_operations() )
+               if( o.valid() )
+                  BOOST_CHECK_EQUAL( o->block_num, b.block_num() );
+            ++replayed;
+         });
+         BOOST_CHECK_EQUAL( replayed, db.head_block_num() );
+         BOOST_CHECK( db.get_applied_operations().empty() );
+      }
+      {
+         fc::temp_directory other_dir( graphene::utilities::temp_directory_path() );
+         database db;
+         db.open(other_dir.path(), make_genesis, "TEST" );
+         db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key,
+                           database::skip_nothing);
+         GRAPHENE_CHECK_THROW( db.replay_operation_log( []( const signed_block& ){} ), fc::exception );
+      }
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+BOOST_AUTO_TEST_CASE( replay_profiler_test )
+{
+   try {
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+      fc::temp_directory out_dir( graphene::utilities::temp_directory_path() );
+      auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("null_key")) );
+      uint32_t head_num = 0;
+      {
+         database db;
+         db.open(data_dir.path(), make_genesis, "TEST" );
+         transfer_operation t;
+         t.to = account_id_type(1);
+         t.amount = asset( 10000000 );
+         signed_transaction trx;
+         set_expiration( db, trx );
+         trx.operations.push_back(t);
+         PUSH_TX( db, trx, ~0 );
+         for( uint32_t i = 0; i < 25; ++i )
+            db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key, ~0);
+         head_num = db.head_block_num();
+         db.close();
+      }
+
+      const uint32_t replay_skip = database::skip_witness_signature | database::skip_transaction_signatures
+                                 | database::skip_transaction_dupe_check | database::skip_tapos_check
+                                 | database::skip_merkle_check | database::skip_witness_schedule_check;
+      auto replay = [&]( const fc::path& output ) {
+         database db;
+         db.wipe( data_dir.path(), false );
+         db.set_replay_profiler( std::make_shared<replay_profiler>( output, 10 ) );
+         graphene::chain::detail::with_skip_flags( db, replay_skip, [&db,&data_dir] () {
+            db.open(data_dir.path(), make_genesis, "TEST" );
+         });
+         db.set_replay_profiler( nullptr );
+         BOOST_CHECK_EQUAL( db.head_block_num(), head_num );
+         std::string contents;
+         fc::read_file_contents( output, contents );
+         std::istringstream in( contents );
+         std::vector<std::string> lines;
+         for( std::string line; std::getline( in, line ); )
+            lines.push_back( line );
+         return lines;
+      };
+
+      auto records = replay( out_dir.path() / "profile.json" );
+      BOOST_REQUIRE_EQUAL( records.size(), ( head_num + 9 ) / 10 );
+      uint64_t blocks = 0;
+      uint64_t operations = 0;
+      uint64_t transfers = 0;
+      for( size_t i = 0; i < records.size(); ++i )
+      {
+         auto record = fc::json::from_string( records[i] ).get_object();
+         BOOST_CHECK_EQUAL( record["first_block"].as_uint64(), i * 10 + 1 );
+         BOOST_CHECK_EQUAL( record["last_block"].as_uint64(), std::min<uint64_t>( (i + 1) * 10, head_num ) );
+         blocks += record["blocks"].as_uint64();
+         operations += record["operations"].as_uint64();
+         const auto& types = record["operation_types"].get_object();
+         if( types.contains( "transfer_operation" ) )
+            transfers += types["transfer_operation"].get_object()["count"].as_uint64();
+      }
+      BOOST_CHECK_EQUAL( blocks, head_num );
+      BOOST_CHECK_EQUAL( operations, 1u );
+      BOOST_CHECK_EQUAL( transfers, 1u );
+
+      auto rows = replay( out_dir.path() / "profile.csv" );
+      BOOST_REQUIRE( !rows.empty() );
+      BOOST_CHECK_EQUAL( rows.front(), "first_block,last_block,category,name,count,seconds" );
+      BOOST_CHECK( std::any_of( rows.begin(), rows.end(), []( const std::string& row ) {
+         return row.find( ",operation,transfer_operation,1," ) != std::string::npos;
+      }));
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+BOOST_AUTO_TEST_CASE( genesis_accounts_test )
+{
+   try {
+      genesis_state_type genesis = make_genesis();
+      const auto owner_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("owner"))).get_public_key();
+      const auto active_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("active"))).get_public_key();
+      const size_t extra_accounts = 30000;
+      for( size_t i = 0; i < extra_accounts; ++i )
+      {
+         if( i % 2 == 0 )
+            genesis.initial_accounts.emplace_back( "bulk" + fc::to_string(i), owner_key );
+         else
+            genesis.initial_accounts.emplace_back( "bulk" + fc::to_string(i), owner_key, active_key, i % 3 == 0 );
+      }
+
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+      database db;
+      db.open(data_dir.path(), [&genesis]{ return genesis; }, "TEST" );
+
+      const auto& accounts_by_name = db.get_index_type<account_index>().indices().get<by_name>();
+      BOOST_CHECK_EQUAL( db.get_dynamic_global_properties().accounts_registered_this_interval,
+                         genesis.initial_accounts.size() );
+      const auto& committee_account = GRAPHENE_COMMITTEE_ACCOUNT(db);
+      const auto& params = db.get_global_properties().parameters;
+      for( size_t i : { size_t(0), size_t(1), size_t(3), extra_accounts - 1 } )
+      {
+         const auto itr = accounts_by_name.find( "bulk" + fc::to_string(i) );
+         BOOST_REQUIRE( itr != accounts_by_name.end() );
+         const account_object& a = *itr;
+         BOOST_CHECK( a.owner == authority(1, owner_key, 1) );
+         BOOST_CHECK( a.active == authority(1, i % 2 == 0 ? owner_key : active_key, 1) );
+         BOOST_CHECK( a.options.memo_key == ( i % 2 == 0 ? owner_key : active_key ) );
+         BOOST_CHECK( a.statistics(db).owner == a.id );
+         BOOST_CHECK_EQUAL( a.statistics(db).name, a.name );
+         BOOST_CHECK_EQUAL( a.network_fee_percentage, params.network_percent_of_fee );
+         if( i % 2 == 1 && i % 3 == 0 )
+         {
+            BOOST_CHECK( a.is_lifetime_member() );
+            BOOST_CHECK( a.registrar == a.get_id() );
+            BOOST_CHECK( a.referrer == a.get_id() );
+            BOOST_CHECK( a.lifetime_referrer == a.get_id() );
+            BOOST_CHECK_EQUAL( a.lifetime_referrer_fee_percentage, GRAPHENE_100_PERCENT - a.network_fee_percentage );
+         }
+         else
+         {
+            BOOST_CHECK( !a.is_lifetime_member() );
+            BOOST_CHECK( a.registrar == GRAPHENE_TEMP_ACCOUNT );
+            BOOST_CHECK( a.referrer == GRAPHENE_COMMITTEE_ACCOUNT );
+            BOOST_CHECK( a.lifetime_referrer == committee_account.lifetime_referrer );
+            BOOST_CHECK_EQUAL( a.lifetime_referrer_fee_percentage, params.lifetime_referrer_percent_of_fee );
+         }
+      }
+
+      // Create the same accounts with the operations genesis used to apply, the objects only differ by their IDs
+      transaction_evaluation_state eval_state( &db );
+      eval_state.skip_fee_schedule_check = true;
+      for( size_t i : { size_t(0), size_t(1), size_t(2), size_t(3), extra_accounts - 1 } )
+      {
+         const auto& account = genesis.initial_accounts[ genesis.initial_accounts.size() - extra_accounts + i ];
+         account_create_operation cop;
+         cop.name = "twin" + fc::to_string(i);
+         cop.registrar = GRAPHENE_TEMP_ACCOUNT;
+         cop.owner = authority(1, account.owner_key, 1);
+         if( account.active_key == public_key_type() )
+         {
+            cop.active = cop.owner;
+            cop.options.memo_key = account.owner_key;
+         }
+         else
+         {
+            cop.active = authority(1, account.active_key, 1);
+            cop.options.memo_key = account.active_key;
+         }
+         const account_id_type twin_id { db.apply_operation( eval_state, cop ).get<object_id_type>() };
+         if( account.is_lifetime_member )
+         {
+            account_upgrade_operation op;
+            op.account_to_upgrade = twin_id;
+            op.upgrade_to_lifetime_member = true;
+            db.apply_operation( eval_state, op );
+         }
+
+         const account_object& bulk = *accounts_by_name.find( account.name );
+         account_object twin = twin_id(db);
+         account_statistics_object twin_stats = twin.statistics(db);
+         if( account.is_lifetime_member )
+         {
+            BOOST_CHECK( twin.registrar == twin_id && twin.referrer == twin_id && twin.lifetime_referrer == twin_id );
+            twin.registrar = twin.referrer = twin.lifetime_referrer = bulk.get_id();
+         }
+         twin.id = bulk.id;
+         twin.name = bulk.name;
+         twin.statistics = bulk.statistics;
+         twin_stats.id = bulk.statistics;
+         twin_stats.owner = bulk.get_id();
+         twin_stats.name = bulk.name;
+         BOOST_CHECK_EQUAL( fc::json::to_string( fc::variant( twin, GRAPHENE_MAX_NESTED_OBJECTS ) ),
+                            fc::json::to_string( fc::variant( bulk, GRAPHENE_MAX_NESTED_OBJECTS ) ) );
+         BOOST_CHECK_EQUAL( fc::json::to_string( fc::variant( twin_stats, GRAPHENE_MAX_NESTED_OBJECTS ) ),
+                            fc::json::to_string( fc::variant( bulk.statistics(db), GRAPHENE_MAX_NESTED_OBJECTS ) ) );
+      }
+
+      // Duplicate names are rejected
+      genesis.initial_accounts.emplace_back( "bulk1", owner_key );
+      fc::temp_directory other_dir( graphene::utilities::temp_directory_path() );
+      database other_db;
+      BOOST_CHECK_THROW( other_db.open(other_dir.path(), [&genesis]{ return genesis; }, "TEST" ), fc::exception );
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+BOOST_AUTO_TEST_CASE( read_genesis_state_test )
+{
+   try {
+      genesis_state_type genesis = make_genesis();
+      genesis.initial_accounts.emplace_back( "quote\"d", genesis.initial_accounts.front().owner_key );
+      genesis.initial_balances.push_back( { address(), GRAPHENE_SYMBOL, 1000 } );
+      genesis_state_type::initial_vesting_balance_type vest;
+      vest.asset_symbol = GRAPHENE_SYMBOL;
+      vest.amount = 500;
+      vest.vesting_duration_seconds = 60;
+      genesis.initial_vesting_balances.push_back( vest );
+      genesis_state_type::initial_asset_type asst;
+      asst.symbol = "BIT";
+      asst.is_bitasset = true;
+      asst.collateral_records.push_back( { address(), 100, 10 } );
+      genesis.initial_assets.push_back( asst );
+
+      const std::string expected = fc::json::to_string( genesis );
+      for( const std::string& json : { expected, fc::json::to_pretty_string( genesis ) } )
+      {
+         std::istringstream in( json );
+         BOOST_CHECK_EQUAL( fc::json::to_string( read_genesis_state( in, 20 ) ), expected );
+      }
+
+      // Unknown members are ignored, missing members keep their defaults
+      {
+         std::istringstream in( R"({"unknown":[{"a":[1,"]"]}],"initial_active_witnesses":7})" );
+         auto partial = read_genesis_state( in, 20 );
+         BOOST_CHECK_EQUAL( partial.initial_active_witnesses, 7u );
+         BOOST_CHECK( partial.initial_accounts.empty() );
+      }
+
+      // Malformed input is rejected
+      for( const std::string& json : { std::string( R"({"initial_accounts":[)" ),
+                                       std::string( R"({"initial_active_witnesses":7} x)" ),
+                                       std::string( R"({"initial_accounts":{}})" ) } )
+      {
+         std::istringstream in( json );
+         BOOST_CHECK_THROW( read_genesis_state( in, 20 ), fc::exception );
+      }
+
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+      fc::json::save_to_file( genesis, data_dir.path() / "genesis.json" );
+      BOOST_CHECK_EQUAL( fc::json::to_string( read_genesis_state_from_file( data_dir.path() / "genesis.json", 20 ) ),
+                         expected );
+   } catch (fc::exception& e) {
+      edump((e.to_detail_string()));
+      throw;
+   }
+}
+
+BOOST_AUTO_TEST_CASE( operation_log_truncation_test )
+{
+   try {
+      fc::temp_directory data_dir( graphene::utilities::temp_directory_path() );
+      auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(string("null_key")) );
+
+      auto generate_blocks = [&init_account_priv_key]( database& db, uint32_t count, uint32_t slot ) {
+         for( uint32_t i = 0; i < count; ++i )
+         {
+            transfer_operation t;
+            t.to = account_id_type(1);
+            t.amount = asset( 1000 + db.head_block_num() * 10 + slot );
+            signed_transaction trx;
+            set_expiration( db, trx );
+            trx.operations.push_back(t);
+            PUSH_TX( db, trx, ~0 );
+            db.generate_block(db.get_slot_time(slot), db.get_scheduled_witness(slot), init_account_priv_key, ~0);
+         }
+      };
+      auto read_log = []( const fc::path& dir ) {
+         std::pair<std::string, std::string> contents;
+         fc::read_file_contents( dir / "database" / "block_num_to_operations" / "index", contents.first );
+         fc::read_file_contents( dir / "database" / "block_num_to_operations" / "operations", contents.second );
+         return contents;
+      };
+      // the operation log of a node which applied only the stored blocks, once each
+      auto full_replay = [&data_dir,&read_log]() {
+         fc::temp_directory replay_dir( graphene::utilities::temp_directory_path() );
+         fc::create_directories( replay_dir.path() / "database" / "block_num_to_block" );
+         for( const char* file : { "index", "blocks" } )
+            fc::copy( data_dir.path() / "database" / "block_num_to_block" / file,
+                      replay_dir.path() / "database" / "block_num_to_block" / file );
+         database db;
+         db.enable_operation_log( true );
+         db.open(replay_dir.path(), make_genesis, "TEST" );
+         db.close();
+         return read_log( replay_dir.path() );
+      };
+      auto check_log = [&data_dir,&read_log,&full_replay]() {
+         const auto log = read_log( data_dir.path() );
+         const auto expected = full_replay();
+         BOOST_CHECK_EQUAL( log.first.size(), expected.first.size() );
+         BOOST_CHECK_EQUAL( log.second.size(), expected.second.size() );
+         BOOST_CHECK( log == expected );
+      };
+
+      {
+         database db;
+         db.enable_operation_log( true );
+         db.open(data_dir.path(), make_genesis, "TEST" );
+         generate_blocks( db, 10, 1 );
+         // switch to other blocks with the same numbers
+         for( uint32_t i = 0; i < 3; ++i )
+            db.pop_block();
+         db.clear_pending();
+         generate_blocks( db, 5, 2 );
+         db.close(); // pops the reversible blocks
+      }
+      {
+         database db;
+         db.enable_operation_log( true );
+         db.open(data_dir.path(), make_genesis, "TEST" ); // applies the popped blocks again
+         generate_blocks( db, 2, 1 );
+         db.close();
+      }
+      check_log();
+
+      {
+         database db;
+         db.wipe( data_dir.path(), false );
+         db.enable_operation_log( true );
+         db.open(data_dir.path(), make_genesis, "TEST" ); // reindexes from the first block
+         db.close();
+      }
+      check_log();
    } catch (fc::exception& e) {
       edump((e.to_detail_string()));
       throw;
@@ -992,6 +1394,163 @@ BOOST_FIXTURE_TEST_CASE( double_sign_check, database_fixture )
 
 } FC_LOG_AND_RETHROW() }
 
+BOOST_FIXTURE_TEST_CASE( unpack_block_from_wire, database_fixture )
+{ try {
+   ACTORS( (alice)(bob) );
+   transfer( account_id_type(), alice_id, asset(100000) );
+   generate_block();
+
+   set_expiration( db, trx );
+   trx.operations.clear();
+   transfer_operation t;
+   t.from = alice_id;
+   t.to = bob_id;
+   t.amount = asset(1000);
+   trx.operations.push_back(t);
+   for( auto& op : trx.operations ) db.current_fee_schedule().set_fee(op);
+   sign( trx, alice_private_key );
+   PUSH_TX( db, trx );
+
+   const signed_block b = generate_block();
+   BOOST_REQUIRE_EQUAL( b.transactions.size(), 1u );
+
+   vector<char> packed = fc::raw::pack( b );
+   const size_t packed_size = packed.size();
+   const signed_block decoded = signed_block::from_wire( std::move(packed) );
+
+   BOOST_CHECK( decoded.id() == b.id() );
+   BOOST_CHECK_EQUAL( decoded.get_packed_size(), packed_size );
+   BOOST_CHECK( decoded.calculate_merkle_root() == b.transaction_merkle_root );
+   BOOST_REQUIRE_EQUAL( decoded.transactions.size(), b.transactions.size() );
+   for( size_t i = 0; i < b.transactions.size(); ++i )
+   {
+      const processed_transaction& wired = decoded.transactions[i];
+      // slice to signed_transaction to compute everything by repacking
+      const signed_transaction repacked = b.transactions[i];
+      BOOST_CHECK( wired.id() == repacked.id() );
+      BOOST_CHECK_EQUAL( wired.get_packed_size(), repacked.get_packed_size() );
+      BOOST_CHECK( wired.merkle_digest() == digest_type::hash( b.transactions[i] ) );
+      BOOST_CHECK( wired.get_signature_keys( db.get_chain_id() )
+                      == signed_transaction( repacked ).get_signature_keys( db.get_chain_id() ) );
+   }
+   BOOST_CHECK( decoded.transactions[0].get_signature_keys( db.get_chain_id() ).count( alice_public_key ) == 1 );
+
+   // the decoded block is accepted as is
+   BOOST_CHECK( db.fetch_block_by_number( db.head_block_num() )->id() == b.id() );
+   db.pop_block();
+   PUSH_BLOCK( db, decoded );
+   BOOST_CHECK( db.head_block_id() == b.id() );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_FIXTURE_TEST_CASE( unpack_non_canonical_block_from_wire, database_fixture )
+{ try {
+   ACTORS( (alice)(bob) );
+   transfer( account_id_type(), alice_id, asset(100000) );
+   generate_block();
+
+   set_expiration( db, trx );
+   trx.operations.clear();
+   transfer_operation t;
+   t.from = alice_id;
+   t.to = bob_id;
+   t.amount = asset(1000);
+   trx.operations.push_back(t);
+   for( auto& op : trx.operations ) db.current_fee_schedule().set_fee(op);
+   sign( trx, alice_private_key );
+   PUSH_TX( db, trx );
+
+   const signed_block b = generate_block();
+   BOOST_REQUIRE_EQUAL( b.transactions.size(), 1u );
+
+   const vector<char> header = fc::raw::pack( static_cast<const signed_block_header&>(b) );
+   const vector<char> packed_trx = fc::raw::pack( b.transactions[0] );
+   // an over-long encoding of 1
+   const vector<char> overlong_one { char(0x81), char(0x00) };
+
+   // the number of transactions
+   vector<char> data = header;
+   data.insert( data.end(), overlong_one.begin(), overlong_one.end() );
+   data.insert( data.end(), packed_trx.begin(), packed_trx.end() );
+   GRAPHENE_REQUIRE_THROW( signed_block::from_wire( std::move(data) ), fc::exception );
+
+   // the number of operations, after ref_block_num, ref_block_prefix and expiration
+   const size_t ops_count_pos = 2 + 4 + 4;
+   BOOST_REQUIRE_EQUAL( int(packed_trx[ops_count_pos]), 1 );
+   data = header;
+   data.push_back( 1 );
+   data.insert( data.end(), packed_trx.begin(), packed_trx.begin() + ops_count_pos );
+   data.insert( data.end(), overlong_one.begin(), overlong_one.end() );
+   data.insert( data.end(), packed_trx.begin() + ops_count_pos + 1, packed_trx.end() );
+   GRAPHENE_REQUIRE_THROW( signed_block::from_wire( std::move(data) ), fc::exception );
+
+   // the canonical encoding is accepted, and copies do not keep its packed size
+   signed_block decoded = signed_block::from_wire( fc::raw::pack( b ) );
+   BOOST_CHECK_EQUAL( decoded.get_packed_size(), fc::raw::pack_size( b ) );
+   signed_block copy = decoded;
+   copy.transactions.push_back( b.transactions[0] );
+   BOOST_CHECK_EQUAL( copy.get_packed_size(), fc::raw::pack_size( copy ) );
+   copy = decoded;
+   copy.transactions.clear();
+   BOOST_CHECK_EQUAL( copy.get_packed_size(), fc::raw::pack_size( copy ) );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_FIXTURE_TEST_CASE( block_view_test, database_fixture )
+{ try {
+   ACTORS( (alice)(bob) );
+   transfer( account_id_type(), alice_id, asset(100000) );
+   generate_block();
+
+   for( int64_t amount = 1; amount <= 3; ++amount )
+   {
+      set_expiration( db, trx );
+      trx.operations.clear();
+      transfer_operation t;
+      t.from = alice_id;
+      t.to = bob_id;
+      t.amount = asset(amount);
+      trx.operations.push_back(t);
+      for( auto& op : trx.operations ) db.current_fee_schedule().set_fee(op);
+      sign( trx, alice_private_key );
+      PUSH_TX( db, trx );
+   }
+   const signed_block b = generate_block();
+   BOOST_REQUIRE_EQUAL( b.transactions.size(), 3u );
+
+   // transactions are unpacked on demand, in any order
+   const signed_block_view view( fc::raw::pack( b ) );
+   BOOST_CHECK( view.header().id() == b.id() );
+   BOOST_CHECK( view.header().transaction_merkle_root == b.transaction_merkle_root );
+   BOOST_REQUIRE_EQUAL( view.transaction_count(), 3u );
+   for( uint32_t i : { 2u, 0u, 1u, 2u } )
+   {
+      const processed_transaction trx_i = view.transaction( i );
+      BOOST_CHECK( trx_i.id() == b.transactions[i].id() );
+      BOOST_CHECK( trx_i.operations[0].get<transfer_operation>().amount == asset(i + 1) );
+   }
+   GRAPHENE_REQUIRE_THROW( view.transaction( 3 ), fc::exception );
+   BOOST_CHECK( view.block().id() == b.id() );
+   BOOST_CHECK( view.packed() == fc::raw::pack( b ) );
+
+   // the database serves the header and single transactions of a stored block
+   generate_blocks( db.get_dynamic_global_properties().next_maintenance_time );
+   generate_block();
+   const uint32_t num = b.block_num();
+   auto header = db.fetch_block_header_by_number( num );
+   BOOST_REQUIRE( header.valid() );
+   BOOST_CHECK( header->id() == b.id() );
+   auto trx_1 = db.fetch_transaction_by_number( num, 1 );
+   BOOST_REQUIRE( trx_1.valid() );
+   BOOST_CHECK( trx_1->id() == b.transactions[1].id() );
+   BOOST_CHECK( !db.fetch_transaction_by_number( num, 3 ).valid() );
+   auto by_id = db.fetch_block_view_by_id( b.id() );
+   BOOST_REQUIRE( by_id.valid() );
+   BOOST_CHECK( by_id->packed() == fc::raw::pack( b ) );
+   BOOST_CHECK( !db.fetch_block_header_by_number( db.head_block_num() + 1 ).valid() );
+
+} FC_LOG_AND_RETHROW() }
+
 BOOST_FIXTURE_TEST_CASE( change_block_interval, database_fixture )
 { try {
    generate_block();
@@ -129,5 +129,79 @@ BOOST_AUTO_TEST_CASE( confidential_test )
 } FC_LOG_AND_RETHROW() }
 
 
+BOOST_AUTO_TEST_CASE( confidential_parallel_validation_test )
+{ try {
+   ACTORS( (dan)(nathan) )
+   const asset_object& core = asset_id_type()(db);
+   transfer(account_id_type()(db), dan, core.amount(1000000));
+
+   auto owner_key = fc::ecc::private_key::generate();
+   const authority owner( 1, public_key_type(owner_key.get_public_key()), 1 );
+
+   auto make_to_blind = [&]( const string& seed, int64_t amount ) {
+      auto b1 = fc::sha256::hash( seed + "1" );
+      auto b2 = fc::sha256::hash( seed + "2" );
+      blind_output out1, out2;
+      out1.owner = owner;
+      out2.owner = owner;
+      out1.commitment = fc::ecc::blind( b1, amount / 4 );
+      out1.range_proof = fc::ecc::range_proof_sign( 0, out1.commitment, b1, fc::sha256::hash("nonce1"), 0, 0,
+                                                    amount / 4 );
+      out2.commitment = fc::ecc::blind( b2, amount - amount / 4 );
+      out2.range_proof = fc::ecc::range_proof_sign( 0, out2.commitment, b2, fc::sha256::hash("nonce2"), 0, 0,
+                                                    amount - amount / 4 );
+      transfer_to_blind_operation to_blind;
+      to_blind.amount = core.amount( amount );
+      to_blind.from = dan_id;
+      to_blind.blinding_factor = fc::ecc::blind_sum( {b1,b2}, 2 );
+      to_blind.outputs = { out1, out2 };
+      if( to_blind.outputs[1].commitment < to_blind.outputs[0].commitment )
+         std::swap( to_blind.outputs[0], to_blind.outputs[1] );
+      return to_blind;
+   };
+
+   transfer_operation xfer;
+   xfer.from = dan_id;
+   xfer.to = nathan_id;
+   xfer.amount = core.amount( 100 );
+
+   // confidential operations of a transaction are validated in parallel with each other and with the others
+   signed_transaction tx;
+   set_expiration( db, tx );
+   tx.operations = { make_to_blind( "a", 1000 ), xfer, make_to_blind( "b", 2000 ) };
+   sign( tx, dan_private_key );
+   precomputable_transaction good( tx );
+   db.precompute_parallel( good ).wait();
+   PUSH_TX( db, good );
+   BOOST_CHECK_EQUAL( get_balance( nathan_id, asset_id_type() ), 100 );
+
+   // an invalid confidential operation fails the precomputation, and the transaction is not marked as validated
+   auto bad_op = make_to_blind( "c", 3000 );
+   std::swap( bad_op.outputs[0], bad_op.outputs[1] );
+   tx.operations = { xfer, bad_op };
+   sign( tx, dan_private_key );
+   precomputable_transaction bad( tx );
+   BOOST_CHECK_THROW( db.precompute_parallel( bad ).wait(), fc::exception );
+   BOOST_CHECK_THROW( bad.validate(), fc::exception );
+   BOOST_CHECK_THROW( db.precompute_parallel( bad ).wait(), fc::exception );
+
+   // the same in a block, where confidential operations are validated apart from their transactions
+   const uint32_t skip = database::skip_witness_signature | database::skip_merkle_check;
+   signed_block block;
+   tx.operations = { make_to_blind( "d", 4000 ) };
+   block.transactions.push_back( processed_transaction( tx ) );
+   tx.operations = { xfer, make_to_blind( "e", 5000 ), make_to_blind( "f", 6000 ) };
+   block.transactions.push_back( processed_transaction( tx ) );
+   db.precompute_parallel( block, skip ).wait();
+   for( const auto& trx : block.transactions )
+      trx.validate();
+
+   signed_block bad_block = block;
+   tx.operations = { bad_op };
+   bad_block.transactions.push_back( processed_transaction( tx ) );
+   BOOST_CHECK_THROW( db.precompute_parallel( bad_block, skip ).wait(), fc::exception );
+   BOOST_CHECK_THROW( bad_block.transactions.back().validate(), fc::exception );
+} FC_LOG_AND_RETHROW() }
+
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -384,6 +384,64 @@ try {
    BOOST_CHECK_EQUAL(storage_results[1].key, "image_url");
    BOOST_CHECK_EQUAL(storage_results[1].value->as_string(), "http://some.other.image.url/img.jpg");
 
+   // query by key range
+   auto page = custom_operations_api.get_storage_by_key_range("alice", "account_object", string("o"), {}, 1);
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 1U );
+   BOOST_CHECK_EQUAL(page.objects[0].key, "patty");
+   BOOST_REQUIRE(page.next_key.valid());
+   BOOST_CHECK_EQUAL(*page.next_key, "robert");
+   page = custom_operations_api.get_storage_by_key_range("alice", "account_object", page.next_key, {}, 1);
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 1U );
+   BOOST_CHECK_EQUAL(page.objects[0].key, "robert");
+   BOOST_CHECK(!page.next_key.valid());
+   page = custom_operations_api.get_storage_by_key_range("alice", "account_object", {}, string("robert"));
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 2U );
+   BOOST_CHECK_EQUAL(page.objects[0].key, "nathan");
+   BOOST_CHECK_EQUAL(page.objects[1].key, "patty");
+   BOOST_CHECK(!page.next_key.valid());
+   GRAPHENE_CHECK_THROW(custom_operations_api.get_storage_by_key_range("alice", "account_object", {}, {}, 7),
+                        fc::exception);
+   // reversed and empty ranges return nothing
+   page = custom_operations_api.get_storage_by_key_range("alice", "account_object", string("robert"),
+                                                         string("nathan"));
+   BOOST_CHECK(page.objects.empty());
+   BOOST_CHECK(!page.next_key.valid());
+   page = custom_operations_api.get_storage_by_key_range("alice", "account_object", string("zzz"),
+                                                         string("a"));
+   BOOST_CHECK(page.objects.empty());
+   BOOST_CHECK(!page.next_key.valid());
+   page = custom_operations_api.get_storage_by_key_range("alice", "account_object", string("patty"),
+                                                         string("patty"));
+   BOOST_CHECK(page.objects.empty());
+   BOOST_CHECK(!page.next_key.valid());
+
+   // query by key prefix
+   page = custom_operations_api.get_storage_by_key_prefix("alice", "account_object", "pa");
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 1U );
+   BOOST_CHECK_EQUAL(page.objects[0].key, "patty");
+   BOOST_CHECK(!page.next_key.valid());
+   page = custom_operations_api.get_storage_by_key_prefix("alice", "account_object", "", {}, 2);
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 2U );
+   BOOST_CHECK_EQUAL(page.objects[1].key, "patty");
+   BOOST_REQUIRE(page.next_key.valid());
+   page = custom_operations_api.get_storage_by_key_prefix("alice", "account_object", "", page.next_key, 2);
+   BOOST_REQUIRE_EQUAL(page.objects.size(), 1U );
+   BOOST_CHECK_EQUAL(page.objects[0].key, "robert");
+   page = custom_operations_api.get_storage_by_key_prefix("alice", "account_object", "x");
+   BOOST_CHECK_EQUAL(page.objects.size(), 0U );
+
+   // query by keys
+   auto values = custom_operations_api.get_storage_by_keys("alice", "account_object", { "robert", "x", "nathan" });
+   BOOST_REQUIRE_EQUAL(values.size(), 3U );
+   BOOST_REQUIRE(values[0].valid());
+   BOOST_CHECK_EQUAL(values[0]->value->as<account_object>(20).name, "robert");
+   BOOST_CHECK(!values[1].valid());
+   BOOST_REQUIRE(values[2].valid());
+   BOOST_CHECK_EQUAL(values[2]->value->as<account_object>(20).name, "nathan");
+   GRAPHENE_CHECK_THROW(custom_operations_api.get_storage_by_keys("alice", "account_object",
+                                                                  vector<string>(7, "nathan")),
+                        fc::exception);
+
 }
 catch (fc::exception &e) {
    edump((e.to_detail_string()));
@@ -128,6 +128,52 @@ BOOST_AUTO_TEST_CASE( get_potential_signatures_owner_and_active )
    } FC_LOG_AND_RETHROW()
 }
 
+BOOST_AUTO_TEST_CASE( get_signatures_batch )
+{
+   try {
+      ACTORS( (alice)(bob) );
+
+      signed_transaction alice_trx;
+      transfer_operation top;
+      top.from = alice_id;
+      top.to = bob_id;
+      alice_trx.operations.push_back( top );
+
+      signed_transaction bob_trx;
+      account_update_operation uop;
+      uop.account = bob_id;
+      uop.owner = authority( 1, public_key_type( alice_private_key.get_public_key() ), 1 );
+      bob_trx.operations.push_back( uop );
+
+      const vector<signed_transaction> trxs { alice_trx, bob_trx, alice_trx };
+
+      graphene::app::application_options opt = app.get_options();
+      graphene::app::database_api db_api( db, &opt );
+
+      // The batch results are the single transaction results, in order
+      const auto potential = db_api.get_potential_signatures_batch( trxs );
+      BOOST_REQUIRE_EQUAL( potential.size(), 3u );
+      for( size_t i = 0; i < trxs.size(); ++i )
+         BOOST_CHECK( potential[i] == db_api.get_potential_signatures( trxs[i] ) );
+
+      const flat_set<public_key_type> keys { alice_public_key, bob_public_key };
+      const auto required = db_api.get_required_signatures_batch( trxs, keys );
+      BOOST_REQUIRE_EQUAL( required.size(), 3u );
+      BOOST_CHECK( required[0] == set<public_key_type>{ alice_public_key } );
+      BOOST_CHECK( required[1] == set<public_key_type>{ bob_public_key } );
+      BOOST_CHECK( required[2] == set<public_key_type>{ alice_public_key } );
+
+      BOOST_CHECK( db_api.get_potential_signatures_batch( {} ).empty() );
+
+      // The number of transactions is limited
+      opt.api_limit_get_signatures_batch = 2;
+      BOOST_CHECK_THROW( db_api.get_potential_signatures_batch( trxs ), fc::exception );
+      BOOST_CHECK_THROW( db_api.get_required_signatures_batch( trxs, keys ), fc::exception );
+      BOOST_CHECK_EQUAL( db_api.get_required_signatures_batch( { alice_trx, bob_trx }, keys ).size(), 2u );
+
+   } FC_LOG_AND_RETHROW()
+}
+
 /// Testing get_potential_signatures and get_required_signatures for non-immediate owner authority issue.
 /// https://github.com/bitshares/bitshares-core/issues/584
 BOOST_AUTO_TEST_CASE( get_signatures_non_immediate_owner )
@@ -29,8 +29,12 @@
 #include <graphene/chain/account_object.hpp>
 #include <graphene/chain/proposal_object.hpp>
 
+#include <graphene/utilities/tempdir.hpp>
+
 #include <fc/crypto/digest.hpp>
 
+#include <fstream>
+
 #include "../common/database_fixture.hpp"
 
 using namespace graphene::chain;
@@ -311,4 +315,95 @@ BOOST_AUTO_TEST_CASE( required_approval_index_test ) // see https://github.com/b
 
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( debug_bulk_updates_test )
+{ try {
+   ACTORS( (alice)(bob) );
+   generate_block();
+
+   const uint32_t head_num = db.head_block_num();
+
+   // binary patches
+   account_object patched_alice = alice_id(db);
+   patched_alice.name = "carol";
+   debug_object_patch patch;
+   patch.action = debug_object_patch::write;
+   patch.id = alice_id;
+   patch.data = fc::raw::pack( patched_alice );
+   db.debug_apply_patches( { patch } );
+
+   BOOST_CHECK_EQUAL( db.head_block_num(), head_num );
+   BOOST_CHECK_EQUAL( alice_id(db).name, "carol" );
+   BOOST_CHECK( db.get_index_type<account_index>().indices().get<by_name>().find( "alice" )
+                == db.get_index_type<account_index>().indices().get<by_name>().end() );
+
+   // JSON updates in a batch, on top of the patches
+   fc::limited_mutable_variant_object update( GRAPHENE_MAX_NESTED_OBJECTS );
+   update( "_action", "update" )( "id", bob_id )( "name", "dave" );
+   db.debug_update( std::vector< fc::variant_object >{ update } );
+
+   BOOST_CHECK_EQUAL( alice_id(db).name, "carol" );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "dave" );
+
+   // revert all
+   db.debug_revert_updates();
+
+   BOOST_CHECK_EQUAL( db.head_block_num(), head_num );
+   BOOST_CHECK_EQUAL( alice_id(db).name, "alice" );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "bob" );
+
+   // updates and patches are applied in the order they were given
+   db.debug_update( std::vector< fc::variant_object >{ update } );
+   account_object patched_bob = bob_id(db);
+   patched_bob.name = "erin";
+   patch.id = bob_id;
+   patch.data = fc::raw::pack( patched_bob );
+   db.debug_apply_patches( { patch } );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "erin" );
+
+   fc::limited_mutable_variant_object field_update( GRAPHENE_MAX_NESTED_OBJECTS );
+   field_update( "_action", "update" )( "id", bob_id )( "name", "frank" );
+   db.debug_update( std::vector< fc::variant_object >{ field_update } );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "frank" );
+
+   // a field update patch only changes its fields
+   debug_object_patch field_patch;
+   field_patch.action = debug_object_patch::update;
+   field_patch.id = bob_id;
+   fc::limited_mutable_variant_object name_update( GRAPHENE_MAX_NESTED_OBJECTS );
+   name_update( "id", bob_id )( "name", "gina" );
+   field_patch.data = db.get_index( bob_id ).object_fields_to_packed( name_update, GRAPHENE_MAX_NESTED_OBJECTS );
+   db.debug_apply_patches( { field_patch } );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "gina" );
+   BOOST_CHECK( bob_id(db).options.memo_key == patched_bob.options.memo_key );
+
+   // fields which the object does not have are rejected
+   std::vector<char> unknown_field = fc::raw::pack( fc::unsigned_int(1) );
+   const std::vector<char> unknown_which = fc::raw::pack( fc::unsigned_int(1000) );
+   unknown_field.insert( unknown_field.end(), unknown_which.begin(), unknown_which.end() );
+   account_object bob_copy = bob_id(db);
+   BOOST_CHECK_THROW( db.get_index( bob_id ).object_fields_from_packed( unknown_field, bob_copy ), fc::exception );
+
+   db.debug_revert_updates();
+   BOOST_CHECK_EQUAL( bob_id(db).name, "bob" );
+
+   // a patch file is applied while it is read, and again when the head block is re-applied
+   fc::temp_directory temp_dir( graphene::utilities::temp_directory_path() );
+   const fc::path patch_path = temp_dir.path() / "patches.bin";
+   {
+      std::ofstream out( patch_path.generic_string(), std::ofstream::binary );
+      fc::raw::pack( out, patch );
+      fc::raw::pack( out, field_patch );
+   }
+   db.debug_apply_patch_file( patch_path );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "gina" );
+   BOOST_CHECK( bob_id(db).options.memo_key == patched_bob.options.memo_key );
+
+   db.debug_update( std::vector< fc::variant_object >{ update } );
+   BOOST_CHECK_EQUAL( bob_id(db).name, "dave" );
+
+   db.debug_revert_updates();
+   BOOST_CHECK_EQUAL( bob_id(db).name, "bob" );
+
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_SUITE_END()
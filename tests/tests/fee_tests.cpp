@@ -716,6 +716,96 @@ BOOST_AUTO_TEST_CASE( account_create_fee_scaling )
    BOOST_CHECK_EQUAL(db.get_global_properties().parameters.get_current_fees().get<account_create_operation>().basic_fee, 1u);
 } FC_LOG_AND_RETHROW() }
 
+BOOST_AUTO_TEST_CASE( fee_payout_accumulator_test )
+{ try {
+   ACTORS( (life)(rog) );
+   upgrade_to_lifetime_member( life_id );
+   upgrade_to_lifetime_member( rog_id );
+
+   std::vector<account_id_type> payers { life_id, rog_id };
+   for( int i = 0; i < 10; ++i )
+      payers.push_back( create_account( "payer" + fc::to_string(i), ( i % 2 == 0 ) ? life : rog,
+                                        ( i % 3 == 0 ) ? life : rog, 50 * GRAPHENE_1_PERCENT ).get_id() );
+   payers.push_back( create_account( "plain" ).get_id() );
+
+   // Pending fees are taken from the payer's balance, as when paying a fee
+   auto add_pending_fees = [this,&payers]( int64_t fees, int64_t vested_fees ) {
+      for( const account_id_type payer : payers )
+      {
+         fund( payer(db), asset( fees + vested_fees ) );
+         db.adjust_balance( payer, asset( -fees - vested_fees ) );
+         db.modify( payer(db).statistics(db), [fees,vested_fees]( account_statistics_object& aso ) {
+            aso.pending_fees += fees;
+            aso.pending_vested_fees += vested_fees;
+         });
+      }
+   };
+
+   // The lifetime members get a cashback balance during the first maintenance
+   add_pending_fees( 10000, 0 );
+   generate_blocks( db.get_dynamic_global_properties().next_maintenance_time );
+   BOOST_REQUIRE( life_id(db).cashback_vb.valid() );
+   BOOST_REQUIRE( rog_id(db).cashback_vb.valid() );
+   generate_block();
+
+   add_pending_fees( 12345, 678 );
+
+   struct payout_state
+   {
+      share_type life_balance;
+      fc::uint128_t life_coin_seconds;
+      share_type rog_balance;
+      fc::uint128_t rog_coin_seconds;
+      share_type accumulated_fees;
+      share_type current_supply;
+   };
+   auto get_state = [this,&life_id,&rog_id]() {
+      payout_state state;
+      const vesting_balance_object& life_vbo = life_id(db).cashback_balance(db);
+      const vesting_balance_object& rog_vbo = rog_id(db).cashback_balance(db);
+      state.life_balance = life_vbo.balance.amount;
+      state.life_coin_seconds = life_vbo.policy.get<cdd_vesting_policy>().coin_seconds_earned;
+      state.rog_balance = rog_vbo.balance.amount;
+      state.rog_coin_seconds = rog_vbo.policy.get<cdd_vesting_policy>().coin_seconds_earned;
+      state.accumulated_fees = db.get_core_dynamic_data().accumulated_fees;
+      state.current_supply = db.get_core_dynamic_data().current_supply;
+      return state;
+   };
+
+   // Pay out one by one, then undo
+   payout_state expected;
+   {
+      auto session = db._undo_db.start_undo_session();
+      for( const account_id_type payer : payers )
+         payer(db).statistics(db).process_fees( payer(db), db );
+      expected = get_state();
+      session.undo();
+   }
+   BOOST_CHECK( get_state().life_balance < expected.life_balance );
+
+   fee_payout_accumulator payouts( db );
+   for( const account_id_type payer : payers )
+      payer(db).statistics(db).process_fees( payer(db), db, &payouts );
+   BOOST_CHECK( payouts.merged_payouts() > 0 );
+   payouts.apply_all();
+
+   const payout_state actual = get_state();
+   BOOST_CHECK_EQUAL( actual.life_balance.value, expected.life_balance.value );
+   BOOST_CHECK( actual.life_coin_seconds == expected.life_coin_seconds );
+   BOOST_CHECK_EQUAL( actual.rog_balance.value, expected.rog_balance.value );
+   BOOST_CHECK( actual.rog_coin_seconds == expected.rog_coin_seconds );
+   BOOST_CHECK_EQUAL( actual.accumulated_fees.value, expected.accumulated_fees.value );
+   BOOST_CHECK_EQUAL( actual.current_supply.value, expected.current_supply.value );
+   for( const account_id_type payer : payers )
+      BOOST_CHECK( !payer(db).statistics(db).has_pending_fees() );
+
+   // The maintenance pays out the same way
+   add_pending_fees( 1000, 100 );
+   generate_blocks( db.get_dynamic_global_properties().next_maintenance_time );
+   for( const account_id_type payer : payers )
+      BOOST_CHECK( !payer(db).statistics(db).has_pending_fees() );
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_CASE( fee_refund_test )
 {
    try
@@ -3976,6 +4066,71 @@ BOOST_AUTO_TEST_CASE( defaults_test )
   }
 }
 
+BOOST_AUTO_TEST_CASE( fee_parameters_lookup_test )
+{ try {
+    // complete schedule: every tag is found at its own position
+    const fee_schedule& complete = fee_schedule::get_default();
+    BOOST_REQUIRE_EQUAL( complete.parameters.size(), static_cast<size_t>( fee_parameters::count() ) );
+    for( fee_parameters::tag_type tag = 0; tag < fee_parameters::count(); ++tag )
+    {
+       auto itr = find_fee_parameters( complete.parameters, tag );
+       BOOST_REQUIRE( itr != complete.parameters.end() );
+       BOOST_CHECK_EQUAL( itr->which(), tag );
+    }
+    BOOST_CHECK( find_fee_parameters( complete.parameters, fee_parameters::count() ) == complete.parameters.end() );
+    BOOST_CHECK( find_fee_parameters( complete.parameters, -1 ) == complete.parameters.end() );
+
+    // incomplete schedule: found by searching, missing tags are not found
+    fee_schedule partial;
+    limit_order_create_operation::fee_params_t order_fee; order_fee.fee = 11;
+    custom_operation::fee_params_t custom_fee; custom_fee.fee = 12;
+    partial.parameters.insert( order_fee );
+    partial.parameters.insert( custom_fee );
+    BOOST_CHECK( find_fee_parameters<limit_order_create_operation>( partial.parameters )
+                 != partial.parameters.end() );
+    BOOST_CHECK( find_fee_parameters<custom_operation>( partial.parameters ) != partial.parameters.end() );
+    BOOST_CHECK( find_fee_parameters<transfer_operation>( partial.parameters ) == partial.parameters.end() );
+    BOOST_CHECK( find_fee_parameters<asset_create_operation>( partial.parameters ) == partial.parameters.end() );
+    BOOST_CHECK_EQUAL( partial.get<limit_order_create_operation>().fee, 11u );
+    BOOST_CHECK_EQUAL( partial.get<custom_operation>().fee, 12u );
+    BOOST_CHECK( partial.exists<custom_operation>() );
+    BOOST_CHECK( !partial.exists<transfer_operation>() );
+
+    // a fee calculated with the cached packed size of an operation equals the one calculated by packing it
+    custom_operation cop;
+    cop.payer = account_id_type(1);
+    cop.data.resize( 5000 );
+    account_update_operation uop;
+    uop.account = account_id_type(1);
+    uop.new_options = account_options();
+    asset_create_operation aop;
+    aop.issuer = account_id_type(1);
+    aop.symbol = "PARENT.SUB";
+    aop.common_options.description = string( 3000, 'x' );
+    precomputable_transaction trx;
+    trx.operations.push_back( cop );
+    trx.operations.push_back( uop );
+    trx.operations.push_back( aop );
+    trx.operations.push_back( limit_order_create_operation() );
+    for( size_t i = 0; i < trx.operations.size(); ++i )
+    {
+       uint64_t size = trx.get_operation_packed_size( i );
+       BOOST_CHECK_EQUAL( size, trx.transaction::get_operation_packed_size( i ) );
+       BOOST_CHECK_EQUAL( complete.calculate_fee( trx.operations[i], size ).amount.value,
+                          complete.calculate_fee( trx.operations[i] ).amount.value );
+    }
+    BOOST_CHECK_EQUAL( trx.get_operation_packed_size( 0 ), fc::raw::pack_size( cop ) );
+    BOOST_CHECK_GT( complete.calculate_fee( cop ).amount.value,
+                    complete.calculate_fee( cop, 0 ).amount.value );
+
+  }
+  catch( const fc::exception& e )
+  {
+     elog( "caught exception ${e}", ("e", e.to_detail_string()) );
+     throw;
+  }
+}
+
 BOOST_AUTO_TEST_CASE( sub_asset_creation_fee_test )
 { try {
    fee_schedule schedule;
@@ -58,4 +58,99 @@ BOOST_AUTO_TEST_CASE(api_limit_get_grouped_limit_orders) {
     throw;
    }
 }
+
+BOOST_AUTO_TEST_CASE(get_grouped_limit_orders_by_price_buckets)
+{ try {
+   ACTORS((alice));
+
+   const asset_object& usd = create_user_issued_asset( "MYUSD" );
+   const asset_id_type usd_id = usd.get_id();
+   fund( alice_id(db), asset(100000) );
+
+   graphene::app::orders_api orders_api(app);
+   const string core = std::string( asset_id_type() );
+   const string usd_str = std::string( usd_id );
+
+   // prices 1, 1.005 and 1.1
+   const limit_order_id_type order1 = create_sell_order( alice_id, asset(10000), usd.amount(10000) )->get_id();
+   create_sell_order( alice_id, asset(10050), usd.amount(10000) );
+   create_sell_order( alice_id, asset(11000), usd.amount(10000) );
+
+   // 1% groups: the first two orders are in the same bucket
+   auto orders = orders_api.get_grouped_limit_orders( core, usd_str, 100, optional<price>(), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 2u );
+   BOOST_CHECK( orders[0].min_price == price( asset(11000), usd.amount(10000) ) );
+   BOOST_CHECK( orders[0].max_price == price( asset(11000), usd.amount(10000) ) );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 11000 );
+   BOOST_CHECK( orders[1].min_price == price( asset(10000), usd.amount(10000) ) );
+   BOOST_CHECK( orders[1].max_price == price( asset(10050), usd.amount(10000) ) );
+   BOOST_CHECK_EQUAL( orders[1].total_for_sale.value, 20050 );
+
+   // 0.1% groups: every order is in its own bucket
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, optional<price>(), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 3u );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 11000 );
+   BOOST_CHECK_EQUAL( orders[1].total_for_sale.value, 10050 );
+   BOOST_CHECK_EQUAL( orders[2].total_for_sale.value, 10000 );
+
+   // limit
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, optional<price>(), 1 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 1u );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 11000 );
+
+   // start from a price inside the second 1% group
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 100, price( asset(10040), usd.amount(10000) ), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 1u );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 20050 );
+
+   // the other direction of the market is empty
+   orders = orders_api.get_grouped_limit_orders( usd_str, core, 100, optional<price>(), 10 );
+   BOOST_CHECK_EQUAL( orders.size(), 0u );
+
+   // not tracked
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 50, optional<price>(), 10 );
+   BOOST_CHECK_EQUAL( orders.size(), 0u );
+
+   // remove an order
+   cancel_limit_order( order1(db) );
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 100, optional<price>(), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 2u );
+   BOOST_CHECK_EQUAL( orders[1].total_for_sale.value, 10050 );
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, optional<price>(), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 2u );
+   BOOST_CHECK_EQUAL( orders[1].total_for_sale.value, 10050 );
+
+   // pending transactions are undone and re-applied when generating a block
+   generate_block();
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, optional<price>(), 10 );
+   BOOST_CHECK_EQUAL( orders.size(), 2u );
+
+} FC_LOG_AND_RETHROW() }
+
+BOOST_AUTO_TEST_CASE(get_grouped_limit_orders_at_extreme_prices)
+{ try {
+   ACTORS((alice));
+
+   const asset_object& usd = create_user_issued_asset( "MYUSD" );
+   fund( alice_id(db), asset(100000) );
+
+   graphene::app::orders_api orders_api(app);
+   const string core = std::string( asset_id_type() );
+   const string usd_str = std::string( usd.get_id() );
+
+   // the buckets of these orders are millions of buckets apart
+   create_sell_order( alice_id, asset(1), usd.amount(GRAPHENE_MAX_SHARE_SUPPLY) );
+   create_sell_order( alice_id, asset(90000), usd.amount(1) );
+
+   auto orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, optional<price>(), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 2u );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 90000 );
+   BOOST_CHECK_EQUAL( orders[1].total_for_sale.value, 1 );
+
+   orders = orders_api.get_grouped_limit_orders( core, usd_str, 10, price( asset(1), usd.amount(1) ), 10 );
+   BOOST_REQUIRE_EQUAL( orders.size(), 1u );
+   BOOST_CHECK_EQUAL( orders[0].total_for_sale.value, 1 );
+
+} FC_LOG_AND_RETHROW() }
+
 BOOST_AUTO_TEST_SUITE_END()